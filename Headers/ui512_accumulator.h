@@ -0,0 +1,64 @@
+#pragma once
+#ifndef ui512_accumulator_h
+#define ui512_accumulator_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_accumulator.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_accumulator.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Sharded 512 bit accumulator, for many threads summing into one total ( use case 1: sum of primes, across all cores ).
+//		Each thread owns a shard: its partial sum, carry count and sequence number, padded to its own cache lines, so adds take no lock
+//		and no line is shared between hot threads. Reads fold the shards ( add_u, add_u_wc ) into a 1024 bit total.
+//		One writer per shard. A read may run alongside the writers: each shard is read under its sequence number ( a seqlock: odd while
+//		an add is under way ), so every shard's contribution is whole; the total is then that of some moment during the read.
+
+#include "CommonTypeDefs.h"
+
+#include <atomic>
+
+struct alignas( 64 ) ui512_shard
+{
+	_UI512( partial );							// sum of the adds, mod 2^512
+	u64 carries;								// count of carries out of partial
+	std::atomic<u64> seq;						// even when at rest
+	u8 pad [ 64 - sizeof( u64 ) - sizeof( std::atomic<u64> ) ];
+};
+
+struct ui512_accumulator
+{
+	ui512_shard* shard;
+	int shards;
+};
+
+// s16 acc_init ( ui512_accumulator* acc, int shards );
+// allocate and zero shards ( one per writing thread ); release with acc_release
+// returns: zero for success, -1 if shards is less than one
+s16 acc_init( ui512_accumulator* acc, int shards );
+
+// void acc_release ( ui512_accumulator* acc );
+void acc_release( ui512_accumulator* acc );
+
+// void acc_add_u ( ui512_accumulator* acc, int shard, const u64* addend );
+// add 512 bit (8 QWORDS) addend into shard ( 0 to shards - 1, owned by the calling thread )
+void acc_add_u( ui512_accumulator* acc, int shard, const u64* addend );
+
+// void acc_add_uT64 ( ui512_accumulator* acc, int shard, u64 addend );
+// add 64 bit addend into shard
+void acc_add_uT64( ui512_accumulator* acc, int shard, u64 addend );
+
+// void acc_read ( const ui512_accumulator* acc, u64* sum, u64* overflow );
+// total of all shards: sum the low 512 bits, overflow the high 512 bits ( as mult_u ); any thread, at any time
+void acc_read( const ui512_accumulator* acc, u64* sum, u64* overflow );
+
+// void acc_clear ( ui512_accumulator* acc );
+// zero all shards; only while no thread is adding
+void acc_clear( ui512_accumulator* acc );
+
+#endif	//ui512_accumulator_h
@@ -0,0 +1,79 @@
+#pragma once
+#ifndef ui512_barrett_h
+#define ui512_barrett_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_barrett.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_barrett.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Division / reduction by a fixed 512 bit divisor, using a precomputed reciprocal (Barrett style).
+//		The reciprocal is computed once (barrett_init); each reduction is then two or three mult_u, plus adds, compares and subtracts.
+//		Dividends are 512 bits, or 1024 bits as the product / overflow pair from mult_u.
+//		Also a 64 bit divisor counterpart of div_uT64 (div64_init, div_uT64_pre, mod_uT64): same method with 64 bit "digits",
+//		one 64x64 multiply per limb in place of a hardware divide.
+//		Ref: N. Moller, T. Granlund, "Improved division by invariant integers", IEEE Trans. Computers 60 (2011), Algorithm 4,
+//			applied with 512 bit "digits".
+
+#include "CommonTypeDefs.h"
+
+struct barrett_ctx
+{
+	_UI512( divisor );		// d, as supplied
+	_UI512( divisor_n );	// d normalized: shifted left until bit 511 is set
+	_UI512( reciprocal );	// floor( ( 2^1024 - 1 ) / divisor_n ) - 2^512
+	u16 shift;				// normalization shift, 0 to 511
+};
+
+// s16 barrett_init ( barrett_ctx* ctx, const u64* divisor );
+// precompute reciprocal for supplied 512bit (8 QWORDS) divisor
+// returns: zero for success, -1 if divisor is zero
+s16 barrett_init( barrett_ctx* ctx, const u64* divisor );
+
+// void barrett_mod ( u64* remainder, const u64* dividend, const barrett_ctx* ctx );
+// remainder of 512 bit dividend divided by the context divisor
+void barrett_mod( u64* remainder, const u64* dividend, const barrett_ctx* ctx );
+
+// void barrett_divmod ( u64* quotient, u64* remainder, const u64* dividend, const barrett_ctx* ctx );
+// 512 bit dividend divided by the context divisor, giving 512 bit quotient and remainder
+void barrett_divmod( u64* quotient, u64* remainder, const u64* dividend, const barrett_ctx* ctx );
+
+// void barrett_mod_1024 ( u64* remainder, const u64* product, const u64* overflow, const barrett_ctx* ctx );
+// remainder of 1024 bit dividend ( overflow * 2^512 + product, as from mult_u ) divided by the context divisor
+void barrett_mod_1024( u64* remainder, const u64* product, const u64* overflow, const barrett_ctx* ctx );
+
+// void barrett_divmod_1024 ( u64* quotient, u64* quotient_overflow, u64* remainder, const u64* product, const u64* overflow, const barrett_ctx* ctx );
+// 1024 bit dividend ( overflow * 2^512 + product ) divided by the context divisor,
+// giving 1024 bit quotient ( quotient_overflow * 2^512 + quotient ) and 512 bit remainder
+void barrett_divmod_1024( u64* quotient, u64* quotient_overflow, u64* remainder, const u64* product, const u64* overflow, const barrett_ctx* ctx );
+
+struct div64_ctx
+{
+	u64 divisor;			// d, as supplied
+	u64 divisor_n;			// d normalized: shifted left until bit 63 is set
+	u64 reciprocal;			// floor( ( 2^128 - 1 ) / divisor_n ) - 2^64
+	u16 shift;				// normalization shift, 0 to 63
+};
+
+// s16 div64_init ( div64_ctx* ctx, u64 divisor );
+// precompute reciprocal for supplied 64 bit divisor
+// returns: zero for success, -1 if divisor is zero
+s16 div64_init( div64_ctx* ctx, u64 divisor );
+
+// s16 div_uT64_pre ( u64* quotient, u64* remainder, const u64* dividend, const div64_ctx* ctx );
+// divide 512 bit dividend by the context 64 bit divisor, giving 512 bit quotient and 64 bit remainder ( as div_uT64 )
+// quotient may be the same array as dividend
+// returns: zero
+s16 div_uT64_pre( u64* quotient, u64* remainder, const u64* dividend, const div64_ctx* ctx );
+
+// u64 mod_uT64 ( const u64* dividend, const div64_ctx* ctx );
+// returns: remainder of 512 bit dividend divided by the context 64 bit divisor
+u64 mod_uT64( const u64* dividend, const div64_ctx* ctx );
+
+#endif	//ui512_barrett_h
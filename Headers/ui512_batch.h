@@ -0,0 +1,63 @@
+#pragma once
+#ifndef ui512_batch_h
+#define ui512_batch_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_batch.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_batch.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Batch kernels: eight independent 512 bit numbers at a time, stored "vertically" ( structure of arrays ): limb k of all eight
+//		numbers shares one 512 bit register, one number per 64 bit lane. The kernels walk the limbs as the single number kernels do, but
+//		each step does eight numbers, carries and borrows kept per lane in mask registers; nothing crosses lanes except in the transposes.
+//		For work that is the same on many independent numbers ( sieving sums, table builds, ECC batches ), not for one long chain.
+//		Register width is chosen at compile time from the compiler target: AVX-512 ( /arch:AVX512 ), else a plain loop over the lanes.
+
+#include "CommonTypeDefs.h"
+
+const int ui512_batch_lanes = 8;
+
+struct alignas( 64 ) ui512_batch
+{
+	u64 limb [ 8 ] [ 8 ];						// limb [ k ] [ lane ]: limb k ( 0 most significant, as _UI512 ) of number lane
+};
+
+// void batch_load ( ui512_batch* dest, const u64* src );
+// transpose in: eight 512 bit (8 QWORDS) numbers, packed one after another ( an array of _UI512, 64 byte aligned ), to lanes 0 to 7
+void batch_load( ui512_batch* dest, const u64* src );
+
+// void batch_store ( u64* dest, const ui512_batch* src );
+// transpose out: lanes 0 to 7 to eight packed 512 bit numbers ( 64 byte aligned )
+void batch_store( u64* dest, const ui512_batch* src );
+
+// u16 batch_add ( ui512_batch* sum, const ui512_batch* addend1, const ui512_batch* addend2 );
+// lane by lane: sum = addend1 + addend2, as add_u; any may overlap
+// returns: carry mask, bit i for lane i
+u16 batch_add( ui512_batch* sum, const ui512_batch* addend1, const ui512_batch* addend2 );
+
+// u16 batch_sub ( ui512_batch* difference, const ui512_batch* minuend, const ui512_batch* subtrahend );
+// lane by lane: difference = minuend - subtrahend, as sub_u; any may overlap
+// returns: borrow mask, bit i for lane i
+u16 batch_sub( ui512_batch* difference, const ui512_batch* minuend, const ui512_batch* subtrahend );
+
+// void batch_mul ( ui512_batch* product, ui512_batch* overflow, const ui512_batch* multiplicand, const ui512_batch* multiplier );
+// lane by lane: 1024 bit product, low half to product, high half to overflow, as mult_u; outputs may overlap the inputs
+void batch_mul( ui512_batch* product, ui512_batch* overflow, const ui512_batch* multiplicand, const ui512_batch* multiplier );
+
+// void batch_compare ( u16* less, u16* equal, const ui512_batch* lh_op, const ui512_batch* rh_op );
+// lane by lane, as compare_u: bit i of less set if lane i of lh_op < rh_op, of equal if they are equal ( greater: neither )
+void batch_compare( u16* less, u16* equal, const ui512_batch* lh_op, const ui512_batch* rh_op );
+
+// void batch_shl ( ui512_batch* dest, const ui512_batch* src, u16 shift );
+// void batch_shr ( ui512_batch* dest, const ui512_batch* src, u16 shift );
+// lane by lane: shift each number left ( right ) by shift bits, zero filled, as shl_u ( shr_u ); shift 512 or more gives zero
+void batch_shl( ui512_batch* dest, const ui512_batch* src, u16 shift );
+void batch_shr( ui512_batch* dest, const ui512_batch* src, u16 shift );
+
+#endif	//ui512_batch_h
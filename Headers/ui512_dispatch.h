@@ -0,0 +1,110 @@
+#pragma once
+#ifndef ui512_dispatch_h
+#define ui512_dispatch_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_dispatch.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_dispatch.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Runtime selection of the Z (512), Y (256), X (128), or Q (64bit) kernel variants.
+//		The host is probed (CPUID) once at startup, and "ui512k" is pointed at the kernel table of the best variant it can run.
+//		Call through the table, e.g.: ui512k->add_u( sum, addend1, addend2 ), to get the selected variant.
+//		The bare externs in ui512_externs.h remain, and call whichever variant was assembled as the default.
+//
+//		The choice of Z/Y/X/Q is an assembly time option. To carry all four variants in one library, assemble each module once per option,
+//		with the option letter appended to each proc name (add_u_Z, add_u_Y, add_u_X, add_u_Q, ...), and define __ui512_MultiVariant here.
+//		Without __ui512_MultiVariant, the table holds only the single assembled variant, identified by __ui512_BuiltVariant (default: Z).
+//
+//		Independent of the variant: if the host reports BMI2 and ADX, ui512k carries mult_u_adx / mult_uT64_adx in place of mult_u / mult_uT64.
+
+#include "CommonTypeDefs.h"
+#include "ui512_externs.h"
+
+enum ui512_variant : s16 { ui512_Q = 0, ui512_X = 1, ui512_Y = 2, ui512_Z = 3, ui512_variant_count = 4 };
+
+#ifndef __ui512_BuiltVariant
+#define __ui512_BuiltVariant ui512_Z
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Processor features relevant to the variants, as reported by CPUID (and XGETBV for operating system register state support)
+
+struct ui512_cpu_features
+{
+	bool sse41;			// X: SSE 4.1
+	bool avx2;			// Y: AVX2, with OS support for YMM state
+	bool avx512f;		// Z: AVX-512 foundation, with OS support for ZMM and opmask state
+	bool avx512bw;
+	bool avx512vl;
+	bool bmi2;			// MULX
+	bool adx;			// ADCX, ADOX
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Kernel table. One per variant. Members mirror the externs in ui512_externs.h, in the same order, with the same signatures.
+
+struct ui512_kernels
+{
+	ui512_variant variant;
+	const char* name;
+
+	void ( *zero_u )( const u64* );
+	void ( *copy_u )( const u64*, const u64* );
+	void ( *set_uT64 )( const u64*, const u64 );
+
+	s16 ( *compare_u )( const u64*, const u64* );
+	s16 ( *compare_uT64 )( const u64*, const u64 );
+
+	s16 ( *add_u )( const u64*, const u64*, const u64* );
+	s16 ( *add_u_wc )( const u64*, const u64*, const u64*, s16 );
+	s16 ( *add_uT64 )( const u64*, const u64*, const u64 );
+
+	s16 ( *sub_u )( const u64*, const u64*, const u64* );
+	s16 ( *sub_u_wb )( const u64*, const u64*, const u64*, const s16 );
+	s16 ( *sub_uT64 )( const u64*, const u64*, const u64 );
+
+	s16 ( *mult_uT64 )( const u64*, const u64*, const u64*, const u64 );
+	s16 ( *mult_u )( const u64*, const u64*, const u64*, const u64* );
+
+	s16 ( *div_uT64 )( const u64*, const u64*, const u64*, const u64 );
+	s16 ( *div_u )( const u64*, const u64*, const u64*, const u64* );
+
+	s16 ( *msb_u )( const u64* );
+	s16 ( *lsb_u )( const u64* );
+
+	void ( *shr_u )( const u64*, const u64*, const u16 );
+	void ( *shl_u )( const u64*, const u64*, const u16 );
+
+	void ( *and_u )( const u64*, const u64*, const u64* );
+	void ( *or_u )( const u64*, const u64*, const u64* );
+	void ( *xor_u )( const u64*, const u64*, const u64* );
+	void ( *not_u )( const u64*, const u64* );
+};
+
+// const ui512_cpu_features& ui512_cpu ( );
+// processor features of the host, probed once (on first call)
+extern const ui512_cpu_features& ui512_cpu( );
+
+// bool ui512_variant_supported ( ui512_variant variant );
+// returns: true if the host processor (and operating system) can execute the variant
+extern bool ui512_variant_supported( ui512_variant );
+
+// bool ui512_mulx_supported ( );
+// returns: true if the host processor reports both BMI2 (MULX) and ADX (ADCX, ADOX), as mult_u_adx / mult_uT64_adx require
+extern bool ui512_mulx_supported( );
+
+// const ui512_kernels* ui512_variant_kernels ( ui512_variant variant );
+// returns: kernel table for the variant, or nullptr if the variant is not in the library, or the host can not execute it
+extern const ui512_kernels* ui512_variant_kernels( ui512_variant );
+
+// kernel table of the best variant this host supports, selected at startup ( with the MULX / ADX multiplies, if supported )
+extern const ui512_kernels* ui512k;
+
+#endif	//ui512_dispatch_h
\ No newline at end of file
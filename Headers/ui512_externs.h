@@ -104,6 +104,41 @@ extern "C"
 	//	Prototype:	s16 mult_u ( u64 * product, u64 * overflow, u64 * multiplicand, u64 * multiplier );
 	s16 mult_u( const u64*, const u64*, const u64*, const u64* );
 
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_multiply.cpp ( C++ with intrinsics, pending an assembler version in ui512_multiply.asm; no alignment requirement )
+	//
+
+	//	sqr_u		square 512 bit multiplicand, giving 512 product, overflow: as mult_u with multiplier == multiplicand,
+	//				each cross product computed once and doubled, 36 64x64 multiplies in place of 64
+	//	Prototype:	s16 sqr_u ( u64 * product, u64 * overflow, u64 * multiplicand );
+	s16 sqr_u( u64*, u64*, const u64* );
+
+	//	mult_u_lo	multiply 512 multiplicand by 512 multiplier, giving the 512 product only ( low half, as mult_u product ); no overflow work
+	//	Prototype:	s16 mult_u_lo ( u64 * product, u64 * multiplicand, u64 * multiplier );
+	s16 mult_u_lo( u64*, const u64*, const u64* );
+
+	//	mult_u_hi	multiply 512 multiplicand by 512 multiplier, giving the 512 overflow only ( high half, as mult_u overflow ), exact
+	//	Prototype:	s16 mult_u_hi ( u64 * overflow, u64 * multiplicand, u64 * multiplier );
+	s16 mult_u_hi( u64*, const u64*, const u64* );
+
+	//	mult_uT64_adx, mult_u_adx	as mult_uT64, mult_u, built on MULX, with two independent carry chains ( ADCX, ADOX ) in place of one
+	//				propagating carry. Requires BMI2 and ADX ( Broadwell and later ); same prototypes as the assembler kernels, so they can
+	//				stand in the kernel table. Selected into ui512k when the processor reports both ( see ui512_dispatch.h )
+	s16 mult_uT64_adx( const u64*, const u64*, const u64*, const u64 );
+	s16 mult_u_adx( const u64*, const u64*, const u64*, const u64* );
+
+	//	mult_u_x4	four independent mult_u in one call, as two pairs: the two products of a pair step together, so their carry chains
+	//				overlap; the pairs run one after the other ( two chains at once, not four: four spill their carries ). For callers with
+	//				several independent products at hand ( see also ui512_batch.h ). Any output may overlap any input
+	//	Prototype:	s16 mult_u_x4 ( u64 * products [ 4 ], u64 * overflows [ 4 ], u64 * multiplicands [ 4 ], u64 * multipliers [ 4 ] );
+	s16 mult_u_x4( u64* const [ 4 ], u64* const [ 4 ], const u64* const [ 4 ], const u64* const [ 4 ] );
+
+	//	div_uT64_x4	four independent div_uT64 in one call, interleaved as mult_u_x4. A zero divisor gives that lane a zero quotient and
+	//				remainder ( the others are still divided ), and a return code of -1
+	//	Prototype:	s16 div_uT64_x4 ( u64 * quotients [ 4 ], u64 * remainders [ 4 ], u64 * dividends [ 4 ], u64 divisors [ 4 ] );
+	s16 div_uT64_x4( u64* const [ 4 ], u64* const [ 4 ], const u64* const [ 4 ], const u64 [ 4 ] );
+
 	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 	//
 	//	from ui512_divide.asm
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef ui512_format_h
+#define ui512_format_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_format.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_format.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Text conversion of 512 bit values, into and out of caller supplied buffers; no allocation.
+//		Decimal: the value is split into base 10^19 chunks ( one div_uT64_pre each ), and each chunk is written two digits at a time from a table.
+//		Hex: fixed width, 128 characters, most significant qword ( [0] ) first, as the documented limb order.
+//		Nibbles are split, converted and validated 16 or 32 characters at a time in SSE2, or AVX2 ( /arch:AVX2 ) registers.
+
+#include "CommonTypeDefs.h"
+
+// longest decimal text of a 512 bit value: 2^512 - 1 has 155 digits
+const int ui512_decimal_max = 155;
+
+// s16 to_decimal ( char* buffer, int buffer_len, const u64* value );
+// write 512 bit (8 QWORDS) value as decimal text, no leading zeros ( "0" for zero ), followed by a terminating zero
+// buffer_len: size of buffer in characters; ui512_decimal_max + 1 is always enough
+// returns: number of digits written ( not counting the terminating zero ), or -1 if buffer is too small ( buffer untouched )
+s16 to_decimal( char* buffer, int buffer_len, const u64* value );
+
+// s16 from_decimal ( u64* value, const char* text, int text_len );
+// read decimal text ( digits only, text_len characters, leading zeros allowed ) into 512 bit (8 QWORDS) value
+// returns: zero for success, -1 if text is empty, holds a non digit, or its value exceeds 2^512 - 1 ( value undefined )
+s16 from_decimal( u64* value, const char* text, int text_len );
+
+// hex text of a 512 bit value: 16 characters per qword
+const int ui512_hex_chars = 128;
+
+// void to_hex ( char* buffer, const u64* value );
+// write 512 bit (8 QWORDS) value as 128 upper case hex characters, value[0] first, followed by a terminating zero
+// buffer: at least ui512_hex_chars + 1 characters
+void to_hex( char* buffer, const u64* value );
+
+// s16 from_hex ( u64* value, const char* text, int text_len );
+// read hex text ( 1 to 128 characters, upper or lower case, no prefix ) into 512 bit (8 QWORDS) value; short text is zero filled on the left
+// returns: zero for success, -1 if length is out of range, or text holds a non hex character ( value undefined )
+s16 from_hex( u64* value, const char* text, int text_len );
+
+// Hex text by value, for messages: the temporary lives to the end of the full expression, so no allocation and no dangling pointer
+struct ui512_hex_text
+{
+	char text [ ui512_hex_chars + 1 ];
+};
+
+inline ui512_hex_text hex_text( const u64* value )
+{
+	ui512_hex_text h;
+	to_hex( h.text, value );
+	return h;
+};
+
+// Macro to convert a ui512 variable to hex text for messaging, as to_hex ( most significant first, no spaces );
+// _MtoHexString ( CommonTypeDefs.h ) keeps its own format
+#define _MtoHexText(ui512var) ( hex_text( ui512var ).text )
+
+#endif	//ui512_format_h
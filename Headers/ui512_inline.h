@@ -0,0 +1,202 @@
+#pragma once
+#ifndef ui512_inline_h
+#define ui512_inline_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_inline.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_inline.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Header only, inline versions of the trivial kernels: zero, copy, set, compare, and the bit ops.
+//		For these, the call, the argument set-up, and the lost chance to keep values in registers cost more than the work itself.
+//		Same semantics, argument order, and limb order as the externs in ui512_externs.h. Each is named as its extern, with "_inl" appended.
+//		Same 64 byte alignment contract: the aligned load / store forms are used, so unaligned arguments fault just as the externs do.
+//
+//		Register width is chosen at compile time from the compiler target: AVX-512 ( /arch:AVX512 ), AVX2 ( /arch:AVX2 ), else SSE2 (x64 baseline).
+
+#include "CommonTypeDefs.h"
+
+#include <immintrin.h>
+
+#if defined( __AVX512F__ )
+#define __ui512_inl_Z
+#elif defined( __AVX2__ )
+#define __ui512_inl_Y
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//	clear, copy, set
+
+// void zero_u_inl ( u64* destarr );
+// fill supplied 512bit (8 QWORDS) with zero
+inline void zero_u_inl( u64* destarr )
+{
+#if defined( __ui512_inl_Z )
+	_mm512_store_si512( destarr, _mm512_setzero_si512( ) );
+#elif defined( __ui512_inl_Y )
+	_mm256_store_si256( ( __m256i* ) destarr, _mm256_setzero_si256( ) );
+	_mm256_store_si256( ( __m256i* ) ( destarr + 4 ), _mm256_setzero_si256( ) );
+#else
+	for ( int i = 0; i < 8; i += 2 )
+	{
+		_mm_store_si128( ( __m128i* ) ( destarr + i ), _mm_setzero_si128( ) );
+	};
+#endif
+};
+
+// void copy_u_inl ( u64* destarr, const u64* srcarr );
+// copy supplied 512bit (8 QWORDS) source to supplied destination
+inline void copy_u_inl( u64* destarr, const u64* srcarr )
+{
+#if defined( __ui512_inl_Z )
+	_mm512_store_si512( destarr, _mm512_load_si512( srcarr ) );
+#elif defined( __ui512_inl_Y )
+	__m256i hi = _mm256_load_si256( ( const __m256i* ) srcarr );
+	__m256i lo = _mm256_load_si256( ( const __m256i* ) ( srcarr + 4 ) );
+	_mm256_store_si256( ( __m256i* ) destarr, hi );
+	_mm256_store_si256( ( __m256i* ) ( destarr + 4 ), lo );
+#else
+	for ( int i = 0; i < 8; i += 2 )
+	{
+		_mm_store_si128( ( __m128i* ) ( destarr + i ), _mm_load_si128( ( const __m128i* ) ( srcarr + i ) ) );
+	};
+#endif
+};
+
+// void set_uT64_inl ( u64* destarr, u64 value );
+// set supplied destination 512 bit to supplied u64 value (in the least significant word, destarr[7])
+inline void set_uT64_inl( u64* destarr, const u64 value )
+{
+#if defined( __ui512_inl_Z )
+	_mm512_store_si512( destarr, _mm512_maskz_set1_epi64( __mmask8( 0x80 ), s64( value ) ) );
+#elif defined( __ui512_inl_Y )
+	_mm256_store_si256( ( __m256i* ) destarr, _mm256_setzero_si256( ) );
+	_mm256_store_si256( ( __m256i* ) ( destarr + 4 ), _mm256_set_epi64x( s64( value ), 0, 0, 0 ) );
+#else
+	for ( int i = 0; i < 6; i += 2 )
+	{
+		_mm_store_si128( ( __m128i* ) ( destarr + i ), _mm_setzero_si128( ) );
+	};
+	_mm_store_si128( ( __m128i* ) ( destarr + 6 ), _mm_set_epi64x( s64( value ), 0 ) );
+#endif
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//	compare
+
+// s16 compare_u_inl ( const u64* lh_op, const u64* rh_op );
+// compare supplied 512bit (8 QWORDS) LH operand to supplied RH operand
+// returns: (0) for equal, -1 for less than, 1 for greater than (logical, unsigned compare)
+inline s16 compare_u_inl( const u64* lh_op, const u64* rh_op )
+{
+	// Find the most significant (lowest index) word that differs, then compare just that word
+	u32 ne = 0;
+#if defined( __ui512_inl_Z )
+	ne = _mm512_cmpneq_epu64_mask( _mm512_load_si512( lh_op ), _mm512_load_si512( rh_op ) );
+#elif defined( __ui512_inl_Y )
+	u32 eqhi = _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpeq_epi64(
+		_mm256_load_si256( ( const __m256i* ) lh_op ), _mm256_load_si256( ( const __m256i* ) rh_op ) ) ) );
+	u32 eqlo = _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpeq_epi64(
+		_mm256_load_si256( ( const __m256i* ) ( lh_op + 4 ) ), _mm256_load_si256( ( const __m256i* ) ( rh_op + 4 ) ) ) ) );
+	ne = ~( eqhi | ( eqlo << 4 ) ) & 0xFF;
+#else
+	for ( int i = 0; i < 8; i++ )
+	{
+		ne |= u32( lh_op [ i ] != rh_op [ i ] ) << i;
+	};
+#endif
+	if ( ne == 0 )
+	{
+		return 0;
+	};
+	u32 idx = _tzcnt_u32( ne );
+	return ( lh_op [ idx ] < rh_op [ idx ] ) ? -1 : 1;
+};
+
+// s16 compare_uT64_inl ( const u64* lh_op, u64 rh_op );
+// compare supplied 512bit (8 QWORDS) LH operand to supplied 64bit RH operand (value)
+// returns: (0) for equal, -1 for less than, 1 for greater than (logical, unsigned compare)
+inline s16 compare_uT64_inl( const u64* lh_op, const u64 rh_op )
+{
+	u64 upper = lh_op [ 0 ] | lh_op [ 1 ] | lh_op [ 2 ] | lh_op [ 3 ] | lh_op [ 4 ] | lh_op [ 5 ] | lh_op [ 6 ];
+	if ( upper != 0 )
+	{
+		return 1;
+	};
+	return ( lh_op [ 7 ] < rh_op ) ? -1 : ( lh_op [ 7 ] > rh_op ) ? 1 : 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//	bit ops
+
+#if defined( __ui512_inl_Z )
+#define __ui512_inl_bitop( dest, lh, rh, op512, op256, op128 )							\
+	_mm512_store_si512( dest, op512( _mm512_load_si512( lh ), _mm512_load_si512( rh ) ) )
+#elif defined( __ui512_inl_Y )
+#define __ui512_inl_bitop( dest, lh, rh, op512, op256, op128 )							\
+	for ( int _i = 0; _i < 8; _i += 4 )													\
+	{																					\
+		_mm256_store_si256( ( __m256i* ) ( dest + _i ),									\
+			op256( _mm256_load_si256( ( const __m256i* ) ( lh + _i ) ),					\
+				_mm256_load_si256( ( const __m256i* ) ( rh + _i ) ) ) );				\
+	}
+#else
+#define __ui512_inl_bitop( dest, lh, rh, op512, op256, op128 )							\
+	for ( int _i = 0; _i < 8; _i += 2 )													\
+	{																					\
+		_mm_store_si128( ( __m128i* ) ( dest + _i ),									\
+			op128( _mm_load_si128( ( const __m128i* ) ( lh + _i ) ),					\
+				_mm_load_si128( ( const __m128i* ) ( rh + _i ) ) ) );					\
+	}
+#endif
+
+// void and_u_inl ( u64* destination, const u64* lh_op, const u64* rh_op );
+// logical 'AND' bits in lh_op, rh_op, put result in destination
+inline void and_u_inl( u64* destination, const u64* lh_op, const u64* rh_op )
+{
+	__ui512_inl_bitop( destination, lh_op, rh_op, _mm512_and_si512, _mm256_and_si256, _mm_and_si128 );
+};
+
+// void or_u_inl ( u64* destination, const u64* lh_op, const u64* rh_op );
+// logical 'OR' bits in lh_op, rh_op, put result in destination
+inline void or_u_inl( u64* destination, const u64* lh_op, const u64* rh_op )
+{
+	__ui512_inl_bitop( destination, lh_op, rh_op, _mm512_or_si512, _mm256_or_si256, _mm_or_si128 );
+};
+
+// void xor_u_inl ( u64* destination, const u64* lh_op, const u64* rh_op );
+// logical 'XOR' bits in lh_op, rh_op, put result in destination
+inline void xor_u_inl( u64* destination, const u64* lh_op, const u64* rh_op )
+{
+	__ui512_inl_bitop( destination, lh_op, rh_op, _mm512_xor_si512, _mm256_xor_si256, _mm_xor_si128 );
+};
+
+// void not_u_inl ( u64* destination, const u64* source );
+// logical 'NOT' bits in source, put result in destination
+inline void not_u_inl( u64* destination, const u64* source )
+{
+#if defined( __ui512_inl_Z )
+	__m512i src = _mm512_load_si512( source );
+	_mm512_store_si512( destination, _mm512_ternarylogic_epi64( src, src, src, 0x55 ) );
+#elif defined( __ui512_inl_Y )
+	const __m256i ones = _mm256_set1_epi64x( -1 );
+	_mm256_store_si256( ( __m256i* ) destination, _mm256_xor_si256( _mm256_load_si256( ( const __m256i* ) source ), ones ) );
+	_mm256_store_si256( ( __m256i* ) ( destination + 4 ), _mm256_xor_si256( _mm256_load_si256( ( const __m256i* ) ( source + 4 ) ), ones ) );
+#else
+	const __m128i ones = _mm_set1_epi64x( -1 );
+	for ( int i = 0; i < 8; i += 2 )
+	{
+		_mm_store_si128( ( __m128i* ) ( destination + i ), _mm_xor_si128( _mm_load_si128( ( const __m128i* ) ( source + i ) ), ones ) );
+	};
+#endif
+};
+
+#undef __ui512_inl_bitop
+
+#endif	//ui512_inline_h
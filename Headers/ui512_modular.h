@@ -0,0 +1,84 @@
+#pragma once
+#ifndef ui512_modular_h
+#define ui512_modular_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_modular.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_modular.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Modular arithmetic on 512 bit values, built on the Montgomery context ( ui512_montgomery.h ); moduli must be odd.
+//		Exponentiation, two ways:
+//			sliding window:		left to right, odd powers of the base precomputed; fewest multiplies. Timing depends on the exponent.
+//			Montgomery ladder:	one square and one multiply for each of the 512 exponent bits, whatever their values, with masked
+//								( not branched ) swaps; for secret exponents ( ECC ). Constant time as far as the kernels are.
+//		Inverse: Bernstein & Yang "safegcd" divsteps, 62 at a time on the low bits, then applied to the full values as one 2x2 matrix update.
+//			The fixed step count ( no branch on the values ) bounds the work at 24 batches; the variable time form stops when done.
+//		Batch inverse: Montgomery's trick, one inverse of the product of all the values, then two multiplies per value to unwind it.
+//		GCD: binary ( Stein ), trailing zeros stripped in one shift; Lehmer, which runs Euclid on the top 62 bits in registers for as long as the
+//			quotients are certain, then applies the step to the full values as one 2x2 cofactor update ( four mult_uT64 ).
+//		Ref: D. Knuth, "The Art of Computer Programming", Vol 2, 3rd Ed, Addison-Wesley, 1998, Section 4.5.2 ( Algorithm B; Algorithm L )
+//		Ref: A. Menezes, P. van Oorschot, S. Vanstone, "Handbook of Applied Cryptography", CRC Press, 1996, Algorithm 14.85
+//		Ref: M. Joye, S. Yen, "The Montgomery Powering Ladder", CHES 2002
+//		Ref: D. J. Bernstein, B. Yang, "Fast constant-time gcd computation and modular inversion", TCHES 2019
+
+#include "CommonTypeDefs.h"
+#include "ui512_montgomery.h"
+
+enum powmod_mode : s16 { powmod_window = 0, powmod_ladder = 1 };
+
+// sliding window width limits, in exponent bits; window 0 asks for a width chosen from the exponent length
+const int powmod_window_max = 7;
+
+// s16 powmod_u ( u64* result, const u64* base, const u64* exp, const u64* modulus, powmod_mode mode, int window );
+// result = base ^ exp mod modulus, each 512 bit (8 QWORDS); base any value, modulus odd
+// window: sliding window width ( 1 to powmod_window_max, 0 for automatic ), ignored for the ladder
+// returns: zero for success, -1 if modulus is even ( including zero ), or window is out of range
+s16 powmod_u( u64* result, const u64* base, const u64* exp, const u64* modulus, powmod_mode mode = powmod_window, int window = 0 );
+
+// s16 mont_pow ( u64* result, const u64* base, const u64* exp, const mont_ctx* ctx, powmod_mode mode, int window );
+// as powmod_u, with the modulus given by an existing Montgomery context ( saves mont_init when the modulus is reused );
+// base, result in ordinary ( not Montgomery ) form
+// returns: zero for success, -1 if window is out of range
+s16 mont_pow( u64* result, const u64* base, const u64* exp, const mont_ctx* ctx, powmod_mode mode = powmod_window, int window = 0 );
+
+// s16 modinv_u ( u64* result, const u64* a, const u64* modulus );
+// result = a^-1 mod modulus ( a * result = 1 mod modulus ), each 512 bit (8 QWORDS); a any value, modulus odd
+// constant time: a fixed count of divsteps, masked updates; for secret values
+// returns: zero for success, -1 if modulus is even ( including zero ), or a has no inverse ( gcd( a, modulus ) not one; result untouched )
+s16 modinv_u( u64* result, const u64* a, const u64* modulus );
+
+// s16 modinv_u_var ( u64* result, const u64* a, const u64* modulus );
+// as modinv_u, variable time ( skips zero bits, stops early, shrinks as the values do ); for public values
+s16 modinv_u_var( u64* result, const u64* a, const u64* modulus );
+
+// int batch_modinv_u ( u64* out, const u64* in, int n, const u64* modulus, u64* scratch );
+// out [ i ] = in [ i ]^-1 mod modulus, for n values, each 512 bit (8 QWORDS), packed one after another ( an array of _UI512 ); modulus odd
+// one modinv_u and 3n - 2 Montgomery multiplies ( one reduces the first value ); values with no inverse ( zero mod modulus, or a shared
+// factor ) are left out of the product, and their outputs zeroed. A shared factor costs one pass of single inverses to find the culprits.
+// scratch: n values, 64 byte aligned, holds the running products; out == in allowed. nullptr uses out as the scratch ( out may then not overlap in )
+// returns: count of values with no inverse, or -1 if modulus is even ( including zero )
+int batch_modinv_u( u64* out, const u64* in, int n, const u64* modulus, u64* scratch = nullptr );
+
+// int mont_batch_inv ( u64* out, const u64* in, int n, const mont_ctx* ctx, u64* scratch );
+// as batch_modinv_u, with the modulus given by an existing Montgomery context ( mont_init is a large part of the cost of small batches )
+// returns: count of values with no inverse
+int mont_batch_inv( u64* out, const u64* in, int n, const mont_ctx* ctx, u64* scratch = nullptr );
+
+// s16 gcd_u ( u64* result, const u64* a, const u64* b );
+// result = greatest common divisor of a, b, each 512 bit (8 QWORDS); binary algorithm. gcd( a, 0 ) = a; gcd( 0, 0 ) = 0
+// returns: zero
+s16 gcd_u( u64* result, const u64* a, const u64* b );
+
+// s16 gcd_u_lehmer ( u64* result, const u64* a, const u64* b );
+// as gcd_u, Lehmer's algorithm; fewer full width steps, each a few multiplies ( or one div_u, when the top bits give no quotient )
+// returns: zero
+s16 gcd_u_lehmer( u64* result, const u64* a, const u64* b );
+
+#endif	//ui512_modular_h
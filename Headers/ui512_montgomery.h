@@ -0,0 +1,53 @@
+#pragma once
+#ifndef ui512_montgomery_h
+#define ui512_montgomery_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_montgomery.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_montgomery.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Montgomery multiplication for a fixed, odd, 512 bit modulus N, with R = 2^512.
+//		Values are carried in Montgomery form ( aR mod N ); a product in that form is reduced with multiplies and adds only, no division.
+//		Precompute a context once per modulus (mont_init), convert operands in (to_mont), multiply / square as often as needed,
+//		then convert the result out (from_mont).
+//		Ref: P. Montgomery, "Modular Multiplication Without Trial Division", Math. Comp. 44 (1985)
+
+#include "CommonTypeDefs.h"
+
+struct mont_ctx
+{
+	_UI512( modulus );		// N (odd)
+	_UI512( n_prime );		// -N^-1 mod R
+	_UI512( r_mod_n );		// R mod N: one, in Montgomery form
+	_UI512( r2_mod_n );		// R^2 mod N: converts into Montgomery form
+};
+
+// s16 mont_init ( mont_ctx* ctx, const u64* modulus );
+// precompute Montgomery context for supplied 512 bit (8 QWORDS) modulus
+// returns: zero for success, -1 if modulus is even (including zero)
+s16 mont_init( mont_ctx* ctx, const u64* modulus );
+
+// void to_mont ( u64* result, const u64* a, const mont_ctx* ctx );
+// convert a (any 512 bit value) into Montgomery form: result = aR mod N
+void to_mont( u64* result, const u64* a, const mont_ctx* ctx );
+
+// void from_mont ( u64* result, const u64* a, const mont_ctx* ctx );
+// convert a (Montgomery form, less than N) out of Montgomery form: result = aR^-1 mod N
+void from_mont( u64* result, const u64* a, const mont_ctx* ctx );
+
+// void mont_mul ( u64* result, const u64* a, const u64* b, const mont_ctx* ctx );
+// Montgomery product of a, b (each less than N): result = abR^-1 mod N
+void mont_mul( u64* result, const u64* a, const u64* b, const mont_ctx* ctx );
+
+// void mont_sqr ( u64* result, const u64* a, const mont_ctx* ctx );
+// Montgomery square of a (less than N): result = aaR^-1 mod N
+void mont_sqr( u64* result, const u64* a, const mont_ctx* ctx );
+
+#endif	//ui512_montgomery_h
@@ -0,0 +1,98 @@
+#pragma once
+#ifndef ui512_primesum_h
+#define ui512_primesum_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_primesum.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_primesum.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Sum of primes ( use case 1 ), by a segmented sieve of Eratosthenes, on all cores.
+//		Wheel: one byte holds the 8 numbers coprime to 30 in each run of 30 ( 2, 3, 5 never stored ); each segment starts from a copy of
+//		a pattern with the multiples of 7, 11, 13 already struck out ( 1001 bytes; the 210 wheel and then some ).
+//		Segments are L1 sized ( 32K bytes, 983,040 numbers ). Primes with many multiples per segment are struck out from a per prime
+//		position; larger primes ( each wheel position strikes at most once per segment ) wait in buckets, one bucket per segment ahead,
+//		and are touched only in segments where they strike.
+//		Work: the range is cut into chunks of segments, many more than threads. Each thread takes chunks from the front of its own
+//		range, and when that runs dry steals from the back of another's ( one atomic word per range, so no locks ).
+//		Sums: 128 bit per segment ( register arithmetic ), folded per chunk into the thread's shard of a ui512_accumulator ( add_u ).
+//		Or, without sieving at all, Lucy_Hedgehog's dynamic program over the values n / k: O( n^3/4 ) time, O( n^1/2 ) space, one thread.
+//		Far fewer steps than the sieve's n, but each is a 512 bit multiply and two subtracts, and the tables take 2 sqrt( n ) ui512
+//		( 2G bytes at 2^48 ); the perf test finds the limit where it overtakes the sieve on all threads.
+//		Checkpoints, for runs of hours: the chunks finished so far and their sum, in a 640 byte record with a CRC32C. Workers only publish
+//		each finished chunk ( a store and a flag ); an I/O thread folds them into its own copy of the record and writes it, so no sieve thread
+//		waits on the disk. The file holds two record slots, written in turn: a write cut short leaves the other slot whole, and the restart
+//		takes the newer slot that checks out.
+//		Ref: C. Bays, R. Hudson, "The segmented sieve of Eratosthenes and primes in arithmetic progressions to 10^12", BIT 17, 1977
+//		Ref: T. Oliveira e Silva, "Fast implementation of the segmented sieve of Eratosthenes", 2002 ( bucket sieve )
+//		Ref: Lucy_Hedgehog, Project Euler forum, problem 10 ( the n / k dynamic program )
+
+#include "CommonTypeDefs.h"
+
+#include <atomic>
+
+// largest limit: the sieving primes ( to 2^24 ) and their positions fit in 32 bits
+const u64 primesum_limit_max = 0x0001000000000000ull;		// 2^48
+
+// sieve segment, in bytes ( 30 numbers each ); sized to L1 data cache
+const int primesum_segment_bytes = 32768;
+
+enum primesum_method : s16 { primesum_sieve = 0, primesum_lucy = 1 };
+
+struct primesum_stats
+{
+	u64 primes;									// count of primes summed
+	u64 chunks;									// work items
+	u64 steals;									// chunks taken from another thread's range
+	int threads;								// threads used
+	double seconds;								// wall clock, sieving primes through the final fold
+	double primes_per_second;					// of the primes found by this run ( not those from a checkpoint )
+	u64 resumed;								// chunks already done in the checkpoint read at the start
+	u64 checkpoints;							// checkpoint records written
+};
+
+// s16 sum_primes_u ( u64* sum, u64 limit, int threads, primesum_stats* stats, primesum_method method );
+// sum = sum of all primes p <= limit, 512 bit (8 QWORDS)
+// threads: worker count, 0 for one per hardware thread ( the sieve; Lucy_Hedgehog runs on the calling thread )
+// stats: if not nullptr, filled with counts and timing ( no chunks or steals for Lucy_Hedgehog )
+// method: sieve, or Lucy_Hedgehog
+// returns: zero for success, -1 if limit exceeds primesum_limit_max, threads is negative, or method is unknown
+s16 sum_primes_u( u64* sum, u64 limit, int threads = 0, primesum_stats* stats = nullptr, primesum_method method = primesum_sieve );
+
+// checkpoint record, one per file slot; chunks of a checkpointed run are sized for at most primesum_checkpoint_chunks
+const u64 primesum_checkpoint_magic = 0x314D55534D495250ull;		// "PRIMSUM1"
+const u32 primesum_checkpoint_version = 1;
+const int primesum_checkpoint_chunks = 4096;
+
+struct alignas( 64 ) primesum_record
+{
+	u64 magic;
+	u32 version;
+	u32 chunks;									// chunk count of the job
+	u64 limit;
+	u64 chunk_bytes;							// chunk size of the job ( kept, so a restart cuts the same chunks, whatever its thread count )
+	u64 primes;									// count of primes in the completed chunks
+	u64 completed;								// count of completed chunks
+	u64 sequence;								// records written; the higher of the two slots is the newer
+	u64 checksum;								// CRC32C of the record, this field taken as zero
+	_UI512( sum );								// sum of the primes in the completed chunks ( not the wheel primes, 2 to 13 )
+	u64 done [ primesum_checkpoint_chunks / 64 ];	// completed chunks, one bit each
+};
+
+// s16 sum_primes_resumable_u ( u64* sum, u64 limit, const char* path, double interval, const std::atomic<bool>* stop, int threads, primesum_stats* stats );
+// as sum_primes_u ( sieve ), with a checkpoint file at path, written every interval seconds ( and at the end ); if the file holds a checkpoint
+// for this limit, only the chunks it lacks are sieved. A finished job leaves its file ( a rerun returns the sum at once ); delete it to start over.
+// stop: if not nullptr, once set no new chunks are started; the chunks under way finish, and the final checkpoint is written
+// returns: zero for a complete sum, 1 if stopped first ( sum then holds only the completed chunks, and the wheel primes ),
+// -1 if limit exceeds primesum_limit_max, threads is negative, interval is not positive, the file can not be opened, or it holds a
+// checkpoint for another limit. A failed write is skipped ( the other slot keeps the previous record ).
+s16 sum_primes_resumable_u( u64* sum, u64 limit, const char* path, double interval, const std::atomic<bool>* stop = nullptr,
+	int threads = 0, primesum_stats* stats = nullptr );
+
+#endif	//ui512_primesum_h
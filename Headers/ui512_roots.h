@@ -0,0 +1,40 @@
+#pragma once
+#ifndef ui512_roots_h
+#define ui512_roots_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_roots.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_roots.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Integer roots of 512 bit values, by Newton's iteration on the ui512 kernels.
+//		The seed is a double precision estimate from the top 53 bits ( scaled by msb_u ), set just above the root, so the iteration falls
+//		monotonically to it: about 26 good bits to start, doubling each step, so a handful of div_u in place of a bit at a time.
+//		Ref: R. Crandall, C. Pomerance, "Prime Numbers: A Computational Perspective", 2nd Ed, Springer, 2005, Algorithm 9.2.11 ( integer roots ),
+//			Section 9.2.2 ( perfect powers )
+
+#include "CommonTypeDefs.h"
+
+// s16 isqrt_u ( u64* root, const u64* value );
+// root = floor( sqrt( value ) ), each 512 bit (8 QWORDS)
+// returns: zero
+s16 isqrt_u( u64* root, const u64* value );
+
+// s16 iroot_u ( u64* root, const u64* value, u32 k );
+// root = floor( k-th root of value ), each 512 bit (8 QWORDS); k = 2 is isqrt_u
+// returns: zero for success, -1 if k is zero
+s16 iroot_u( u64* root, const u64* value, u32 k );
+
+// s16 is_perfect_power_u ( u64* root, u32* exponent, const u64* value );
+// value = root ^ exponent, with the largest exponent ( so root is not itself a perfect power ); prime exponents are tried, each hit then
+// taken again on its root. Zero and one are not counted ( root = value, exponent = 1 ).
+// returns: 1 if value is a perfect power ( exponent 2 or more ), zero if not ( root = value, exponent = 1 )
+s16 is_perfect_power_u( u64* root, u32* exponent, const u64* value );
+
+#endif	//ui512_roots_h
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef ui512_table_h
+#define ui512_table_h
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_table.h
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_table.h
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Binary tables of 512 bit values ( precomputed points, residues, partial sums ), memory mapped: no parsing, no copying.
+//		File: a 64 byte header, then count records of width values each, 64 bytes per value, limbs as in memory ( [0] most significant ).
+//		The mapping starts on a page, so every record is 64 byte aligned, and the kernels work on the mapped pages in place.
+//		Read only mappings are shared: processes mapping the same table share one copy in the page cache.
+//		Windows: CreateFileMapping / MapViewOfFile; elsewhere: mmap. Values are stored in the machine's byte order ( x64: little endian ).
+
+#include "CommonTypeDefs.h"
+
+const u64 ui512_table_magic = 0x4C42415432313549ull;		// "I512TABL"
+const u32 ui512_table_version = 1;
+
+struct alignas( 64 ) ui512_table_header
+{
+	u64 magic;
+	u32 version;
+	u32 width;									// 512 bit values per record
+	u64 count;									// records
+	u64 tag;									// the caller's, to tell one kind of table from another
+	u64 reserved [ 4 ];
+};
+
+struct ui512_table
+{
+	u64* records;								// first record ( 64 byte aligned ); do not write through a read only mapping
+	u64 count;
+	u32 width;
+	u64 tag;
+	bool writable;
+	void* base;									// the mapping ( header first )
+	u64 bytes;
+	void* handle;								// Windows: the file of a writable mapping, for table_sync; else nullptr
+};
+
+// hints for table_advise; flags, combine with |
+enum table_advice : s16 { table_advice_none = 0, table_advice_sequential = 1, table_advice_random = 2, table_advice_hugepage = 4 };
+
+// s16 table_create ( ui512_table* table, const char* path, u64 count, u32 width, u64 tag );
+// create ( or replace ) the file at path for count records of width values, zero filled, and map it for reading and writing
+// returns: zero for success, -1 if width is zero, the size overflows, or the file can not be created or mapped
+s16 table_create( ui512_table* table, const char* path, u64 count, u32 width, u64 tag );
+
+// s16 table_open ( ui512_table* table, const char* path, bool writable );
+// map an existing table; read only ( writable false ) mappings share pages with every other process mapping the file
+// returns: zero for success, -1 if the file can not be opened or mapped, or its header or size is not that of a table
+s16 table_open( ui512_table* table, const char* path, bool writable = false );
+
+// s16 table_advise ( ui512_table* table, int advice );
+// pass access hints to the OS: sequential ( read ahead ), random ( no read ahead ), hugepage ( back with large pages where the OS can )
+// hints the platform lacks are ignored
+// returns: zero, or -1 if the OS refused a hint
+s16 table_advise( ui512_table* table, int advice );
+
+// s16 table_sync ( ui512_table* table );
+// write a writable table's changed pages back to the file, and wait until they are written ( both platforms )
+// returns: zero for success, -1 on failure
+s16 table_sync( ui512_table* table );
+
+// void table_close ( ui512_table* table );
+// unmap ( changes to a writable table reach the file; table_sync first to wait for them )
+void table_close( ui512_table* table );
+
+// u64* table_record ( const ui512_table* table, u64 index );
+// record index: width values, 8 QWORDS each
+inline u64* table_record( const ui512_table* table, u64 index )
+{
+	return table->records + index * table->width * 8;
+};
+
+#endif	//ui512_table_h
@@ -52,9 +52,20 @@ namespace ui512_Unit_Tests
 		std::vector<double>* x_i;
 		std::vector<double>* z_score;
 		std::vector<outlier>* outliers;
+		double throughput_cycles;					// clock cycles per call, back to back over the operand pool ( perf_mode_throughput )
+		double throughput_per_second;				// calls per second, the same run by the wall clock
+		double chain_cycles;						// clock cycles per call, each call's output the next one's input ( perf_mode_chain )
+		double timer_overhead;						// clock cycles of an empty measurement, included in the samples above
+		double corrected_mean;						// mean, less timer_overhead
+		double corrected_min;						// min, less timer_overhead
 	};
 
-	enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb };
+	// Performance modes, flags: what RunStats measures. Chosen for each run, not each build, by the environment variable UI512_PERF_MODE:
+	// any of "latency", "throughput", "chain" ( latency over a dependent chain of calls ), "fixed" ( latency samples on the same operands
+	// every call ), or "all"; unset: latency, throughput and chain
+	enum perf_mode : s16 { perf_mode_latency = 1, perf_mode_throughput = 2, perf_mode_fixed = 4, perf_mode_chain = 8 };
+
+	enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb, MontMul, MontSqr, BarrettMod, BarrettMod1024, Div64Pre, Mod64, ToDecimal, FromDecimal, ToHex, FromHex, Sqr, MulLo, MulHi, MulAdx, Mul64Adx, PowModWindow, PowModLadder, ModInv, ModInvVar, GcdBinary, GcdLehmer, GcdEuclid, Isqrt, IsqrtBits, Iroot3, PerfectPower, BatchAdd, AddX8, BatchMul, MulX8, BatchTranspose, MulX4, Mul4Calls, Div64X4, Div64_4Calls };
 
 	extern const s32 test_run_count;
 	extern const s32 reg_verification_count;
@@ -65,6 +76,8 @@ namespace ui512_Unit_Tests
 	extern const s32 timing_count_long;
 
 	extern std::vector<perf_stats> Perf_Test_Parms;
+	extern const int Perf_Mode;
+	extern const double Timer_Overhead;			// clock cycles of an empty TimerStart / TimerStop pair, measured at start up
 
 	extern const std::string TestName [ ]; // use perf_test enum as index
 
@@ -72,8 +85,12 @@ namespace ui512_Unit_Tests
 
 	extern u64 RandomU64( u64* seed );
 	extern void RandomFill( u64* var, u64* seed );
+	extern void IsqrtBitwise( u64* root, const u64* value );
 
+	extern bool PerfTestSupported( Perf_Tests test_sel );
 	extern void RunStats( perf_stats* stat, Perf_Tests test_sel );
+	extern void RunThroughput( perf_stats* stat, Perf_Tests test_sel, bool report );
+	extern void RunChain( perf_stats* stat, Perf_Tests test_sel, bool report );
 };
 
 #endif // ui512_unit_test_h
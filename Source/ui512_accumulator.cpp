@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_accumulator
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_accumulator.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Sharded 512 bit accumulator, built on the ui512 kernels. Writers touch only their own shard; the sequence number is bumped to odd
+//		before an add and back to even after, so a reader can tell a whole partial from one caught mid add, and try again.
+
+#include "ui512_accumulator.h"
+#include "ui512_externs.h"
+
+s16 acc_init( ui512_accumulator* acc, int shards )
+{
+	if ( shards < 1 )
+	{
+		return -1;
+	};
+	acc->shard = new ui512_shard [ shards ];
+	acc->shards = shards;
+	acc_clear( acc );
+
+	return 0;
+};
+
+void acc_release( ui512_accumulator* acc )
+{
+	delete [ ] acc->shard;
+	acc->shard = nullptr;
+	acc->shards = 0;
+};
+
+void acc_clear( ui512_accumulator* acc )
+{
+	for ( int i = 0; i < acc->shards; i++ )
+	{
+		zero_u( acc->shard [ i ].partial );
+		acc->shard [ i ].carries = 0;
+		acc->shard [ i ].seq.store( 0, std::memory_order_release );
+	};
+};
+
+// only the owning thread writes seq, so a plain load of it is current
+void acc_add_u( ui512_accumulator* acc, int shard, const u64* addend )
+{
+	ui512_shard* s = &acc->shard [ shard ];
+	u64 seq = s->seq.load( std::memory_order_relaxed );
+	s->seq.store( seq + 1, std::memory_order_relaxed );
+	std::atomic_thread_fence( std::memory_order_release );
+	s->carries += u64( add_u( s->partial, s->partial, addend ) );
+	s->seq.store( seq + 2, std::memory_order_release );
+};
+
+void acc_add_uT64( ui512_accumulator* acc, int shard, u64 addend )
+{
+	ui512_shard* s = &acc->shard [ shard ];
+	u64 seq = s->seq.load( std::memory_order_relaxed );
+	s->seq.store( seq + 1, std::memory_order_relaxed );
+	std::atomic_thread_fence( std::memory_order_release );
+	s->carries += u64( add_uT64( s->partial, s->partial, addend ) );
+	s->seq.store( seq + 2, std::memory_order_release );
+};
+
+void acc_read( const ui512_accumulator* acc, u64* sum, u64* overflow )
+{
+	_UI512( partial ) { 0 };
+	_UI512( carries ) { 0 };
+	zero_u( sum );
+	zero_u( overflow );
+	for ( int i = 0; i < acc->shards; i++ )
+	{
+		// a whole snapshot of the shard: same even sequence number before and after the copy
+		const ui512_shard* s = &acc->shard [ i ];
+		u64 before = 0;
+		u64 after = 0;
+		u64 c = 0;
+		do
+		{
+			before = s->seq.load( std::memory_order_acquire );
+			copy_u( partial, s->partial );
+			c = s->carries;
+			std::atomic_thread_fence( std::memory_order_acquire );
+			after = s->seq.load( std::memory_order_relaxed );
+		} while ( ( before & 1 ) != 0 || before != after );
+
+		// 1024 bit fold: ( overflow, sum ) += ( carries, partial )
+		set_uT64( carries, c );
+		s16 carry = add_u( sum, sum, partial );
+		add_u_wc( overflow, overflow, carries, carry );
+	};
+};
@@ -0,0 +1,241 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_barrett
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_barrett.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Division by a fixed divisor with a precomputed reciprocal, built on the ui512 kernels.
+//		Treats 512 bits as one "digit" (base B = 2^512): a 1024 bit value is a two digit number, and dividing it by a
+//		normalized one digit divisor is the two-by-one step of Moller & Granlund, with reciprocal v = floor( ( B^2 - 1 ) / d ) - B.
+
+#include "ui512_barrett.h"
+#include "ui512_externs.h"
+#include <intrin.h>
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Two-by-one step: ( u1 * B + u0 ) / d, d normalized, u1 < d. Quotient q, remainder r.
+// q, r may not overlap u1, u0.
+//
+//	( q1, q0 ) = v * u1 + ( u1, u0 )
+//	q1 = q1 + 1
+//	r = u0 - q1 * d mod B
+//	if r > q0:	q1 = q1 - 1, r = r + d
+//	if r >= d:	q1 = q1 + 1, r = r - d		(unlikely)
+
+static void div_2by1( u64* q, u64* r, const u64* u1, const u64* u0, const barrett_ctx* ctx )
+{
+	_UI512( q0 ) { 0 };
+
+	mult_u( q0, q, ctx->reciprocal, u1 );
+	s16 carry = add_u( q0, q0, u0 );
+	add_u_wc( q, q, u1, carry );
+	add_uT64( q, q, 1ull );
+
+	mult_u_lo( r, q, ctx->divisor_n );
+	sub_u( r, u0, r );
+
+	if ( compare_u( r, q0 ) > 0 )
+	{
+		sub_uT64( q, q, 1ull );
+		add_u( r, r, ctx->divisor_n );
+	};
+	if ( compare_u( r, ctx->divisor_n ) >= 0 )
+	{
+		add_uT64( q, q, 1ull );
+		sub_u( r, r, ctx->divisor_n );
+	};
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Normalization helpers: shifting the dividend left by the divisor's normalization shift spills bits into the next higher digit
+
+static void shift_in( u64* dest, const u64* hi, const u64* lo, u16 shift )
+{
+	// dest = ( hi << shift ) | ( lo >> ( 512 - shift ) )
+	_UI512( spill ) { 0 };
+	shl_u( dest, hi, shift );
+	if ( shift != 0 )
+	{
+		shr_u( spill, lo, u16( 512 - shift ) );
+		or_u( dest, dest, spill );
+	};
+};
+
+static void spill_out( u64* dest, const u64* hi, u16 shift )
+{
+	// dest = hi >> ( 512 - shift )
+	if ( shift == 0 )
+	{
+		zero_u( dest );
+	}
+	else
+	{
+		shr_u( dest, hi, u16( 512 - shift ) );
+	};
+};
+
+s16 barrett_init( barrett_ctx* ctx, const u64* divisor )
+{
+	s16 msb = msb_u( divisor );
+	if ( msb < 0 )
+	{
+		return -1;
+	};
+
+	copy_u( ctx->divisor, divisor );
+	ctx->shift = u16( 511 - msb );
+	shl_u( ctx->divisor_n, divisor, ctx->shift );
+
+	// v = floor( ( B^2 - 1 ) / d ) - B = floor( ( ~d * B + ( B - 1 ) ) / d ), with ~d < d.
+	// Restoring binary long division, one quotient bit per step; the low digit ( B - 1 ) brings in a one bit each step.
+	_UI512( rem ) { 0 };
+	_UI512( v ) { 0 };
+	not_u( rem, ctx->divisor_n );
+	zero_u( v );
+	for ( int i = 0; i < 512; i++ )
+	{
+		bool top = ( rem [ 0 ] & 0x8000000000000000ull ) != 0;
+		shl_u( rem, rem, 1 );
+		rem [ 7 ] |= 1ull;
+		shl_u( v, v, 1 );
+		if ( top || compare_u( rem, ctx->divisor_n ) >= 0 )
+		{
+			sub_u( rem, rem, ctx->divisor_n );
+			v [ 7 ] |= 1ull;
+		};
+	};
+	copy_u( ctx->reciprocal, v );
+
+	return 0;
+};
+
+void barrett_divmod( u64* quotient, u64* remainder, const u64* dividend, const barrett_ctx* ctx )
+{
+	_UI512( u1 ) { 0 };
+	_UI512( u0 ) { 0 };
+	_UI512( r ) { 0 };
+
+	spill_out( u1, dividend, ctx->shift );
+	shl_u( u0, dividend, ctx->shift );
+	div_2by1( quotient, r, u1, u0, ctx );
+	shr_u( remainder, r, ctx->shift );
+};
+
+void barrett_mod( u64* remainder, const u64* dividend, const barrett_ctx* ctx )
+{
+	_UI512( quotient ) { 0 };
+	barrett_divmod( quotient, remainder, dividend, ctx );
+};
+
+void barrett_divmod_1024( u64* quotient, u64* quotient_overflow, u64* remainder, const u64* product, const u64* overflow, const barrett_ctx* ctx )
+{
+	_UI512( u2 ) { 0 };
+	_UI512( u1 ) { 0 };
+	_UI512( u0 ) { 0 };
+	_UI512( r ) { 0 };
+	_UI512( q ) { 0 };
+
+	spill_out( u2, overflow, ctx->shift );
+	shift_in( u1, overflow, product, ctx->shift );
+	shl_u( u0, product, ctx->shift );
+
+	// High digit first ( u2 < d always, as u2 holds at most "shift" bits ), then the low digit, carrying the remainder down
+	div_2by1( quotient_overflow, r, u2, u1, ctx );
+	div_2by1( q, u1, r, u0, ctx );
+	copy_u( quotient, q );
+	shr_u( remainder, u1, ctx->shift );
+};
+
+void barrett_mod_1024( u64* remainder, const u64* product, const u64* overflow, const barrett_ctx* ctx )
+{
+	_UI512( quotient ) { 0 };
+	_UI512( quotient_overflow ) { 0 };
+	barrett_divmod_1024( quotient, quotient_overflow, remainder, product, overflow, ctx );
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// 64 bit divisor: the same two-by-one step with 64 bit digits, run once per limb, most significant limb first.
+
+static inline u64 div_2by1_64( u64* r, u64 u1, u64 u0, u64 d, u64 v )
+{
+	u64 q1 = 0;
+	u64 q0 = _umul128( v, u1, &q1 );
+	q0 += u0;
+	q1 += u1 + 1 + ( q0 < u0 );
+	u64 rem = u0 - q1 * d;
+	if ( rem > q0 )
+	{
+		q1--;
+		rem += d;
+	};
+	if ( rem >= d )
+	{
+		q1++;
+		rem -= d;
+	};
+	*r = rem;
+	return q1;
+};
+
+s16 div64_init( div64_ctx* ctx, u64 divisor )
+{
+	if ( divisor == 0 )
+	{
+		return -1;
+	};
+
+	unsigned long msb = 0;
+	_BitScanReverse64( &msb, divisor );
+	ctx->divisor = divisor;
+	ctx->shift = u16( 63 - msb );
+	ctx->divisor_n = divisor << ctx->shift;
+
+	// v = floor( ( 2^128 - 1 ) / d ) - 2^64 = floor( ( ~d * 2^64 + ( 2^64 - 1 ) ) / d ), with ~d < d, so one hardware divide
+	u64 rem = 0;
+	ctx->reciprocal = _udiv128( ~ctx->divisor_n, ~0ull, ctx->divisor_n, &rem );
+
+	return 0;
+};
+
+s16 div_uT64_pre( u64* quotient, u64* remainder, const u64* dividend, const div64_ctx* ctx )
+{
+	const u16 s = ctx->shift;
+	const u16 rs = u16( 64 - s );
+	const u64 d = ctx->divisor_n;
+	const u64 v = ctx->reciprocal;
+
+	// normalize on the fly: each limb shifted left by s, taking the top s bits of the next lower limb
+	u64 r = ( s == 0 ) ? 0 : dividend [ 0 ] >> rs;
+	for ( int i = 0; i < 7; i++ )
+	{
+		u64 limb = ( s == 0 ) ? dividend [ i ] : ( dividend [ i ] << s ) | ( dividend [ i + 1 ] >> rs );
+		quotient [ i ] = div_2by1_64( &r, r, limb, d, v );
+	};
+	quotient [ 7 ] = div_2by1_64( &r, r, dividend [ 7 ] << s, d, v );
+	*remainder = r >> s;
+
+	return 0;
+};
+
+u64 mod_uT64( const u64* dividend, const div64_ctx* ctx )
+{
+	const u16 s = ctx->shift;
+	const u16 rs = u16( 64 - s );
+	const u64 d = ctx->divisor_n;
+	const u64 v = ctx->reciprocal;
+
+	u64 r = ( s == 0 ) ? 0 : dividend [ 0 ] >> rs;
+	for ( int i = 0; i < 7; i++ )
+	{
+		u64 limb = ( s == 0 ) ? dividend [ i ] : ( dividend [ i ] << s ) | ( dividend [ i + 1 ] >> rs );
+		div_2by1_64( &r, r, limb, d, v );
+	};
+	div_2by1_64( &r, r, dividend [ 7 ] << s, d, v );
+
+	return r >> s;
+};
@@ -0,0 +1,365 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_batch
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_batch.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Vertical ( structure of arrays ) kernels, eight numbers per call.
+//		Add, subtract: least significant limb first, as the single number kernels; the carry is a mask, and a carry in is added under it.
+//		Multiply: AVX-512F has only a 32 x 32 bit lane multiply ( vpmuludq ), so each number is taken as sixteen 32 bit digits. Each of the
+//		256 digit products is split, the low half added into its column, the high half into the next; 64 bit columns have room for all
+//		of them ( under 2^37 ), so the carries are settled once, at the end, in one pass over the 32 columns.
+//		Without AVX-512: each lane is gathered into a _UI512, run through the single number kernel, and scattered back.
+
+#include "ui512_batch.h"
+#include "ui512_externs.h"
+
+#include <immintrin.h>
+
+#if defined( __AVX512F__ )
+#define __ui512_batch_Z
+#endif
+
+#if defined( __ui512_batch_Z )
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// 8 x 8 qword transpose: row i of in to column i of out; its own inverse. Three rounds: qword pairs, 128 bit lanes, 256 bit halves.
+
+static inline void transpose8( __m512i* out, const __m512i* in )
+{
+	__m512i t [ 8 ];
+	__m512i u [ 8 ];
+	for ( int i = 0; i < 8; i += 2 )
+	{
+		t [ i ] = _mm512_unpacklo_epi64( in [ i ], in [ i + 1 ] );			// r(i)0 r(i+1)0 r(i)2 r(i+1)2 ...
+		t [ i + 1 ] = _mm512_unpackhi_epi64( in [ i ], in [ i + 1 ] );		// r(i)1 r(i+1)1 r(i)3 r(i+1)3 ...
+	};
+	for ( int i = 0; i < 8; i += 4 )
+	{
+		u [ i ] = _mm512_shuffle_i64x2( t [ i ], t [ i + 2 ], 0x88 );		// columns 0, 4 of rows i to i + 3
+		u [ i + 1 ] = _mm512_shuffle_i64x2( t [ i + 1 ], t [ i + 3 ], 0x88 );	// columns 1, 5
+		u [ i + 2 ] = _mm512_shuffle_i64x2( t [ i ], t [ i + 2 ], 0xDD );		// columns 2, 6
+		u [ i + 3 ] = _mm512_shuffle_i64x2( t [ i + 1 ], t [ i + 3 ], 0xDD );	// columns 3, 7
+	};
+	for ( int c = 0; c < 4; c++ )
+	{
+		out [ c ] = _mm512_shuffle_i64x2( u [ c ], u [ c + 4 ], 0x88 );
+		out [ c + 4 ] = _mm512_shuffle_i64x2( u [ c ], u [ c + 4 ], 0xDD );
+	};
+};
+
+static inline void load8( __m512i* v, const u64* src )
+{
+	for ( int k = 0; k < 8; k++ )
+	{
+		v [ k ] = _mm512_load_si512( src + k * 8 );
+	};
+};
+
+static inline void store8( u64* dest, const __m512i* v )
+{
+	for ( int k = 0; k < 8; k++ )
+	{
+		_mm512_store_si512( dest + k * 8, v [ k ] );
+	};
+};
+
+void batch_load( ui512_batch* dest, const u64* src )
+{
+	__m512i in [ 8 ];
+	__m512i out [ 8 ];
+	load8( in, src );
+	transpose8( out, in );
+	store8( &dest->limb [ 0 ] [ 0 ], out );
+};
+
+void batch_store( u64* dest, const ui512_batch* src )
+{
+	__m512i in [ 8 ];
+	__m512i out [ 8 ];
+	load8( in, &src->limb [ 0 ] [ 0 ] );
+	transpose8( out, in );
+	store8( dest, out );
+};
+
+u16 batch_add( ui512_batch* sum, const ui512_batch* addend1, const ui512_batch* addend2 )
+{
+	const __m512i one = _mm512_set1_epi64( 1 );
+	__mmask8 carry = 0;
+	for ( int k = 7; k >= 0; k-- )
+	{
+		__m512i a = _mm512_load_si512( addend1->limb [ k ] );
+		__m512i s = _mm512_add_epi64( a, _mm512_load_si512( addend2->limb [ k ] ) );
+		__mmask8 out = _mm512_cmplt_epu64_mask( s, a );
+		s = _mm512_mask_add_epi64( s, carry, s, one );
+		carry = out | ( carry & _mm512_cmpeq_epu64_mask( s, _mm512_setzero_si512( ) ) );	// carry in to all ones wraps to zero
+		_mm512_store_si512( sum->limb [ k ], s );
+	};
+	return u16( carry );
+};
+
+u16 batch_sub( ui512_batch* difference, const ui512_batch* minuend, const ui512_batch* subtrahend )
+{
+	const __m512i one = _mm512_set1_epi64( 1 );
+	__mmask8 borrow = 0;
+	for ( int k = 7; k >= 0; k-- )
+	{
+		__m512i a = _mm512_load_si512( minuend->limb [ k ] );
+		__m512i b = _mm512_load_si512( subtrahend->limb [ k ] );
+		__m512i d = _mm512_sub_epi64( a, b );
+		__mmask8 out = _mm512_cmplt_epu64_mask( a, b ) | ( borrow & _mm512_cmpeq_epu64_mask( d, _mm512_setzero_si512( ) ) );	// borrow from zero
+		d = _mm512_mask_sub_epi64( d, borrow, d, one );
+		borrow = out;
+		_mm512_store_si512( difference->limb [ k ], d );
+	};
+	return u16( borrow );
+};
+
+void batch_mul( ui512_batch* product, ui512_batch* overflow, const ui512_batch* multiplicand, const ui512_batch* multiplier )
+{
+	// digit d ( 0 least significant ) is half of limb 7 - d / 2; vpmuludq reads only the low 32 bits of each lane, so even digits need no mask
+	__m512i a [ 16 ];
+	__m512i b [ 16 ];
+	for ( int k = 0; k < 8; k++ )
+	{
+		__m512i x = _mm512_load_si512( multiplicand->limb [ 7 - k ] );
+		__m512i y = _mm512_load_si512( multiplier->limb [ 7 - k ] );
+		a [ 2 * k ] = x;
+		a [ 2 * k + 1 ] = _mm512_srli_epi64( x, 32 );
+		b [ 2 * k ] = y;
+		b [ 2 * k + 1 ] = _mm512_srli_epi64( y, 32 );
+	};
+
+	const __m512i low32 = _mm512_set1_epi64( 0xFFFFFFFFll );
+	__m512i col [ 32 ];
+	for ( int c = 0; c < 32; c++ )
+	{
+		col [ c ] = _mm512_setzero_si512( );
+	};
+	for ( int i = 0; i < 16; i++ )
+	{
+		for ( int j = 0; j < 16; j++ )
+		{
+			__m512i p = _mm512_mul_epu32( a [ i ], b [ j ] );
+			col [ i + j ] = _mm512_add_epi64( col [ i + j ], _mm512_and_si512( p, low32 ) );
+			col [ i + j + 1 ] = _mm512_add_epi64( col [ i + j + 1 ], _mm512_srli_epi64( p, 32 ) );
+		};
+	};
+
+	// settle the carries, then pair the digits into limbs: digits 0 to 15 the product, 16 to 31 the overflow
+	__m512i carry = _mm512_setzero_si512( );
+	for ( int c = 0; c < 32; c++ )
+	{
+		__m512i t = _mm512_add_epi64( col [ c ], carry );
+		col [ c ] = _mm512_and_si512( t, low32 );
+		carry = _mm512_srli_epi64( t, 32 );
+	};
+	for ( int m = 0; m < 8; m++ )
+	{
+		_mm512_store_si512( product->limb [ 7 - m ], _mm512_or_si512( col [ 2 * m ], _mm512_slli_epi64( col [ 2 * m + 1 ], 32 ) ) );
+		_mm512_store_si512( overflow->limb [ 7 - m ], _mm512_or_si512( col [ 16 + 2 * m ], _mm512_slli_epi64( col [ 17 + 2 * m ], 32 ) ) );
+	};
+};
+
+void batch_compare( u16* less, u16* equal, const ui512_batch* lh_op, const ui512_batch* rh_op )
+{
+	// most significant limb first; a lane is decided at its first unequal limb
+	__mmask8 lt = 0;
+	__mmask8 open = 0xFF;
+	for ( int k = 0; k < 8; k++ )
+	{
+		__m512i a = _mm512_load_si512( lh_op->limb [ k ] );
+		__m512i b = _mm512_load_si512( rh_op->limb [ k ] );
+		lt |= open & _mm512_cmplt_epu64_mask( a, b );
+		open &= _mm512_cmpeq_epu64_mask( a, b );
+	};
+	*less = u16( lt );
+	*equal = u16( open );
+};
+
+void batch_shl( ui512_batch* dest, const ui512_batch* src, u16 shift )
+{
+	// dest limb k = src limb k + w shifted left b, with the top of limb k + w + 1; shift counts over 63 give zero ( b = 0 drops that part )
+	const int w = shift / 64;
+	const __m128i b = _mm_cvtsi32_si128( shift % 64 );
+	const __m128i rb = _mm_cvtsi32_si128( 64 - shift % 64 );
+	__m512i v [ 8 ];
+	load8( v, &src->limb [ 0 ] [ 0 ] );
+	for ( int k = 0; k < 8; k++ )
+	{
+		__m512i r = _mm512_setzero_si512( );
+		if ( k + w < 8 )
+		{
+			r = _mm512_sll_epi64( v [ k + w ], b );
+		};
+		if ( k + w + 1 < 8 )
+		{
+			r = _mm512_or_si512( r, _mm512_srl_epi64( v [ k + w + 1 ], rb ) );
+		};
+		_mm512_store_si512( dest->limb [ k ], r );
+	};
+};
+
+void batch_shr( ui512_batch* dest, const ui512_batch* src, u16 shift )
+{
+	const int w = shift / 64;
+	const __m128i b = _mm_cvtsi32_si128( shift % 64 );
+	const __m128i rb = _mm_cvtsi32_si128( 64 - shift % 64 );
+	__m512i v [ 8 ];
+	load8( v, &src->limb [ 0 ] [ 0 ] );
+	for ( int k = 0; k < 8; k++ )
+	{
+		__m512i r = _mm512_setzero_si512( );
+		if ( k - w >= 0 )
+		{
+			r = _mm512_srl_epi64( v [ k - w ], b );
+		};
+		if ( k - w - 1 >= 0 )
+		{
+			r = _mm512_or_si512( r, _mm512_sll_epi64( v [ k - w - 1 ], rb ) );
+		};
+		_mm512_store_si512( dest->limb [ k ], r );
+	};
+};
+
+#else
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Lane at a time, through the single number kernels
+
+static inline void gather( u64* x, const ui512_batch* b, int lane )
+{
+	for ( int k = 0; k < 8; k++ )
+	{
+		x [ k ] = b->limb [ k ] [ lane ];
+	};
+};
+
+static inline void scatter( ui512_batch* b, int lane, const u64* x )
+{
+	for ( int k = 0; k < 8; k++ )
+	{
+		b->limb [ k ] [ lane ] = x [ k ];
+	};
+};
+
+void batch_load( ui512_batch* dest, const u64* src )
+{
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		scatter( dest, lane, src + lane * 8 );
+	};
+};
+
+void batch_store( u64* dest, const ui512_batch* src )
+{
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		gather( dest + lane * 8, src, lane );
+	};
+};
+
+u16 batch_add( ui512_batch* sum, const ui512_batch* addend1, const ui512_batch* addend2 )
+{
+	_UI512( x ) { 0 };
+	_UI512( y ) { 0 };
+	u16 carry = 0;
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		gather( x, addend1, lane );
+		gather( y, addend2, lane );
+		carry |= u16( add_u( x, x, y ) << lane );
+		scatter( sum, lane, x );
+	};
+	return carry;
+};
+
+u16 batch_sub( ui512_batch* difference, const ui512_batch* minuend, const ui512_batch* subtrahend )
+{
+	_UI512( x ) { 0 };
+	_UI512( y ) { 0 };
+	u16 borrow = 0;
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		gather( x, minuend, lane );
+		gather( y, subtrahend, lane );
+		borrow |= u16( sub_u( x, x, y ) << lane );
+		scatter( difference, lane, x );
+	};
+	return borrow;
+};
+
+void batch_mul( ui512_batch* product, ui512_batch* overflow, const ui512_batch* multiplicand, const ui512_batch* multiplier )
+{
+	_UI512( x ) { 0 };
+	_UI512( y ) { 0 };
+	_UI512( lo ) { 0 };
+	_UI512( hi ) { 0 };
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		gather( x, multiplicand, lane );
+		gather( y, multiplier, lane );
+		mult_u( lo, hi, x, y );
+		scatter( product, lane, lo );
+		scatter( overflow, lane, hi );
+	};
+};
+
+void batch_compare( u16* less, u16* equal, const ui512_batch* lh_op, const ui512_batch* rh_op )
+{
+	_UI512( x ) { 0 };
+	_UI512( y ) { 0 };
+	*less = 0;
+	*equal = 0;
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		gather( x, lh_op, lane );
+		gather( y, rh_op, lane );
+		s16 c = compare_u( x, y );
+		*less |= u16( ( c < 0 ) << lane );
+		*equal |= u16( ( c == 0 ) << lane );
+	};
+};
+
+void batch_shl( ui512_batch* dest, const ui512_batch* src, u16 shift )
+{
+	_UI512( x ) { 0 };
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		gather( x, src, lane );
+		if ( shift < 512 )
+		{
+			shl_u( x, x, shift );
+		}
+		else
+		{
+			zero_u( x );
+		};
+		scatter( dest, lane, x );
+	};
+};
+
+void batch_shr( ui512_batch* dest, const ui512_batch* src, u16 shift )
+{
+	_UI512( x ) { 0 };
+	for ( int lane = 0; lane < 8; lane++ )
+	{
+		gather( x, src, lane );
+		if ( shift < 512 )
+		{
+			shr_u( x, x, shift );
+		}
+		else
+		{
+			zero_u( x );
+		};
+		scatter( dest, lane, x );
+	};
+};
+
+#endif
@@ -0,0 +1,210 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_dispatch
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_dispatch.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Probes the host processor once, at startup, and selects the best of the Z/Y/X/Q kernel variants it can execute.
+//		See ui512_dispatch.h for how to build a library carrying more than one variant.
+
+#include "ui512_dispatch.h"
+
+#include "intrin.h"
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Kernel table construction. "sfx" is the variant suffix appended to each proc name (empty for the single assembled variant)
+
+#define UI512_KERNEL_TABLE( variant, name, sfx )												\
+	{																							\
+		variant, name,																			\
+		&zero_u##sfx, &copy_u##sfx, &set_uT64##sfx,												\
+		&compare_u##sfx, &compare_uT64##sfx,													\
+		&add_u##sfx, &add_u_wc##sfx, &add_uT64##sfx,											\
+		&sub_u##sfx, &sub_u_wb##sfx, &sub_uT64##sfx,											\
+		&mult_uT64##sfx, &mult_u##sfx,															\
+		&div_uT64##sfx, &div_u##sfx,															\
+		&msb_u##sfx, &lsb_u##sfx,																\
+		&shr_u##sfx, &shl_u##sfx,																\
+		&and_u##sfx, &or_u##sfx, &xor_u##sfx, &not_u##sfx										\
+	}
+
+#ifdef __ui512_MultiVariant
+
+#define UI512_VARIANT_EXTERNS( sfx )															\
+	extern "C"																					\
+	{																							\
+		void zero_u##sfx( const u64* );															\
+		void copy_u##sfx( const u64*, const u64* );												\
+		void set_uT64##sfx( const u64*, const u64 );											\
+		s16 compare_u##sfx( const u64*, const u64* );											\
+		s16 compare_uT64##sfx( const u64*, const u64 );											\
+		s16 add_u##sfx( const u64*, const u64*, const u64* );									\
+		s16 add_u_wc##sfx( const u64*, const u64*, const u64*, s16 );							\
+		s16 add_uT64##sfx( const u64*, const u64*, const u64 );									\
+		s16 sub_u##sfx( const u64*, const u64*, const u64* );									\
+		s16 sub_u_wb##sfx( const u64*, const u64*, const u64*, const s16 );						\
+		s16 sub_uT64##sfx( const u64*, const u64*, const u64 );									\
+		s16 mult_uT64##sfx( const u64*, const u64*, const u64*, const u64 );					\
+		s16 mult_u##sfx( const u64*, const u64*, const u64*, const u64* );						\
+		s16 div_uT64##sfx( const u64*, const u64*, const u64*, const u64 );						\
+		s16 div_u##sfx( const u64*, const u64*, const u64*, const u64* );						\
+		s16 msb_u##sfx( const u64* );															\
+		s16 lsb_u##sfx( const u64* );															\
+		void shr_u##sfx( const u64*, const u64*, const u16 );									\
+		void shl_u##sfx( const u64*, const u64*, const u16 );									\
+		void and_u##sfx( const u64*, const u64*, const u64* );									\
+		void or_u##sfx( const u64*, const u64*, const u64* );									\
+		void xor_u##sfx( const u64*, const u64*, const u64* );									\
+		void not_u##sfx( const u64*, const u64* );												\
+	}
+
+UI512_VARIANT_EXTERNS( _Q )
+UI512_VARIANT_EXTERNS( _X )
+UI512_VARIANT_EXTERNS( _Y )
+UI512_VARIANT_EXTERNS( _Z )
+
+static const ui512_kernels variant_tables [ ui512_variant_count ] =
+{
+	UI512_KERNEL_TABLE( ui512_Q, "Q (64 bit)", _Q ),
+	UI512_KERNEL_TABLE( ui512_X, "X (128 bit SSE)", _X ),
+	UI512_KERNEL_TABLE( ui512_Y, "Y (256 bit AVX2)", _Y ),
+	UI512_KERNEL_TABLE( ui512_Z, "Z (512 bit AVX-512)", _Z )
+};
+
+static const ui512_kernels* built_variant( ui512_variant variant )
+{
+	return &variant_tables [ variant ];
+};
+
+#else
+
+static const char* const variant_names [ ui512_variant_count ] = { "Q (64 bit)", "X (128 bit SSE)", "Y (256 bit AVX2)", "Z (512 bit AVX-512)" };
+
+static const ui512_kernels assembled_table = UI512_KERNEL_TABLE( __ui512_BuiltVariant, variant_names [ __ui512_BuiltVariant ], );
+
+static const ui512_kernels* built_variant( ui512_variant variant )
+{
+	return ( variant == __ui512_BuiltVariant ) ? &assembled_table : nullptr;
+};
+
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// CPUID probe
+
+static ui512_cpu_features probe_cpu( )
+{
+	ui512_cpu_features f { };
+	int regs [ 4 ] { };		// eax, ebx, ecx, edx
+
+	__cpuid( regs, 0 );
+	int max_leaf = regs [ 0 ];
+
+	__cpuid( regs, 1 );
+	bool osxsave = ( regs [ 2 ] & ( 1 << 27 ) ) != 0;
+	bool avx = ( regs [ 2 ] & ( 1 << 28 ) ) != 0;
+	f.sse41 = ( regs [ 2 ] & ( 1 << 19 ) ) != 0;
+
+	// Operating system must save / restore the wider register state, or the instructions are not usable
+	u64 xcr0 = osxsave ? _xgetbv( 0 ) : 0;
+	bool os_ymm = avx && ( ( xcr0 & 0x06 ) == 0x06 );		// XMM, YMM
+	bool os_zmm = os_ymm && ( ( xcr0 & 0xE6 ) == 0xE6 );	// XMM, YMM, opmask, ZMM_Hi256, Hi16_ZMM
+
+	if ( max_leaf >= 7 )
+	{
+		__cpuidex( regs, 7, 0 );
+		u32 ebx = u32( regs [ 1 ] );
+		f.avx2 = os_ymm && ( ebx & ( 1u << 5 ) ) != 0;
+		f.bmi2 = ( ebx & ( 1u << 8 ) ) != 0;
+		f.avx512f = os_zmm && ( ebx & ( 1u << 16 ) ) != 0;
+		f.adx = ( ebx & ( 1u << 19 ) ) != 0;
+		f.avx512bw = os_zmm && ( ebx & ( 1u << 30 ) ) != 0;
+		f.avx512vl = os_zmm && ( ebx & ( 1u << 31 ) ) != 0;
+	};
+
+	return f;
+};
+
+const ui512_cpu_features& ui512_cpu( )
+{
+	static const ui512_cpu_features features = probe_cpu( );
+	return features;
+};
+
+bool ui512_variant_supported( ui512_variant variant )
+{
+	const ui512_cpu_features& f = ui512_cpu( );
+	switch ( variant )
+	{
+	case ui512_Q:
+		return true;
+	case ui512_X:
+		return f.sse41;
+	case ui512_Y:
+		return f.avx2;
+	case ui512_Z:
+		return f.avx512f;
+	default:
+		return false;
+	};
+};
+
+bool ui512_mulx_supported( )
+{
+	const ui512_cpu_features& f = ui512_cpu( );
+	return f.bmi2 && f.adx;
+};
+
+const ui512_kernels* ui512_variant_kernels( ui512_variant variant )
+{
+	if ( variant < ui512_Q || variant >= ui512_variant_count || !ui512_variant_supported( variant ) )
+	{
+		return nullptr;
+	};
+	return built_variant( variant );
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Startup selection: widest supported variant present in the library.
+// If the library carries only a variant the host can not run, fall back to it anyway (the bare externs would fault the same way).
+// Then, if the host has MULX and ADCX / ADOX, a copy of that table with the dual carry chain multiplies.
+
+static const char* const mulx_names [ ui512_variant_count ] =
+{
+	"Q (64 bit), MULX/ADX multiply", "X (128 bit SSE), MULX/ADX multiply", "Y (256 bit AVX2), MULX/ADX multiply", "Z (512 bit AVX-512), MULX/ADX multiply"
+};
+
+static const ui512_kernels* select_variant( )
+{
+	for ( int v = ui512_Z; v >= ui512_Q; v-- )
+	{
+		const ui512_kernels* k = ui512_variant_kernels( ui512_variant( v ) );
+		if ( k != nullptr )
+		{
+			return k;
+		};
+	};
+	return built_variant( __ui512_BuiltVariant );
+};
+
+static const ui512_kernels* select_kernels( )
+{
+	const ui512_kernels* k = select_variant( );
+	if ( k == nullptr || !ui512_mulx_supported( ) )
+	{
+		return k;
+	};
+
+	static ui512_kernels with_mulx = *k;
+	with_mulx.name = mulx_names [ k->variant ];
+	with_mulx.mult_uT64 = &mult_uT64_adx;
+	with_mulx.mult_u = &mult_u_adx;
+	return &with_mulx;
+};
+
+const ui512_kernels* ui512k = select_kernels( );
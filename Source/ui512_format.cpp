@@ -0,0 +1,255 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_format
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_format.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Decimal text conversion of 512 bit values, built on the ui512 kernels and the 64 bit precomputed reciprocal divide.
+//		10^19 is the largest power of ten in a qword, so at most nine chunks ( 171 digits ) cover 2^512 - 1.
+//		Hex text conversion in SIMD registers, no kernels: AVX2 if the compiler targets it ( /arch:AVX2 ), else SSE2 ( x64 baseline ).
+
+#include "ui512_format.h"
+#include "ui512_barrett.h"
+#include "ui512_externs.h"
+
+#include <immintrin.h>
+#include <intrin.h>
+
+#if defined( __AVX2__ )
+#define __ui512_fmt_Y
+#endif
+
+static const u64 chunk_divisor = 10000000000000000000ull;		// 10^19
+static const int chunk_digits = 19;
+static const int chunk_max = 9;
+
+// "00" through "99"
+static const char digit_pairs [ ] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static div64_ctx make_chunk_ctx( )
+{
+	div64_ctx ctx;
+	div64_init( &ctx, chunk_divisor );							// 10^19: not zero, can not fail
+	return ctx;
+};
+
+static const div64_ctx* chunk_ctx( )
+{
+	static const div64_ctx ctx = make_chunk_ctx( );				// once, on first use
+	return &ctx;
+};
+
+// write chunk ( less than 10^19 ) as exactly 19 digits, leading zeros included
+static void write_chunk( char* dest, u64 chunk )
+{
+	for ( int i = chunk_digits - 1; i > 0; i -= 2 )
+	{
+		u64 pair = chunk % 100;
+		chunk /= 100;
+		dest [ i - 1 ] = digit_pairs [ pair * 2 ];
+		dest [ i ] = digit_pairs [ pair * 2 + 1 ];
+	};
+	dest [ 0 ] = char( '0' + chunk );
+};
+
+s16 to_decimal( char* buffer, int buffer_len, const u64* value )
+{
+	const div64_ctx* ctx = chunk_ctx( );
+	u64 chunks [ chunk_max ] = { 0 };
+	int count = 0;
+
+	// chunks, least significant first
+	_UI512( q ) { 0 };
+	copy_u( q, value );
+	do
+	{
+		div_uT64_pre( q, &chunks [ count++ ], q, ctx );
+	} while ( compare_uT64( q, 0ull ) != 0 );
+
+	// most significant chunk without its leading zeros ( one zero kept for a zero value ), the rest at full width
+	char top [ chunk_digits ];
+	write_chunk( top, chunks [ count - 1 ] );
+	int lead = 0;
+	while ( lead < chunk_digits - 1 && top [ lead ] == '0' )
+	{
+		lead++;
+	};
+	int digits = ( chunk_digits - lead ) + chunk_digits * ( count - 1 );
+	if ( digits + 1 > buffer_len )
+	{
+		return -1;
+	};
+
+	char* p = buffer;
+	for ( int i = lead; i < chunk_digits; i++ )
+	{
+		*p++ = top [ i ];
+	};
+	for ( int c = count - 2; c >= 0; c-- )
+	{
+		write_chunk( p, chunks [ c ] );
+		p += chunk_digits;
+	};
+	*p = 0;
+
+	return s16( digits );
+};
+
+s16 from_decimal( u64* value, const char* text, int text_len )
+{
+	if ( text_len <= 0 )
+	{
+		return -1;
+	};
+
+	// first chunk takes the odd digits, so the rest are full 19 digit chunks: value = value * 10^19 + chunk
+	int pos = 0;
+	int len = text_len % chunk_digits;
+	if ( len == 0 )
+	{
+		len = chunk_digits;
+	};
+	while ( pos < text_len )
+	{
+		u64 chunk = 0;
+		for ( int i = pos; i < pos + len; i++ )
+		{
+			u64 digit = u64( text [ i ] ) - u64( '0' );
+			if ( digit > 9 )
+			{
+				return -1;
+			};
+			chunk = chunk * 10 + digit;
+		};
+
+		if ( pos == 0 )
+		{
+			set_uT64( value, chunk );
+		}
+		else
+		{
+			u64 overflow = 0;
+			mult_uT64( value, &overflow, value, chunk_divisor );
+			if ( overflow != 0 || add_uT64( value, value, chunk ) != 0 )
+			{
+				return -1;
+			};
+		};
+		pos += len;
+		len = chunk_digits;
+	};
+
+	return 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Hex
+
+void to_hex( char* buffer, const u64* value )
+{
+#if defined( __ui512_fmt_Y )
+	// four qwords per pass: reverse the bytes of each qword ( most significant first ), split into nibbles, look up characters
+	const __m256i reverse = _mm256_setr_epi8(
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+	const __m256i digits = _mm256_setr_epi8(
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' );
+	const __m256i low4 = _mm256_set1_epi8( 0x0F );
+	for ( int i = 0; i < 8; i += 4 )
+	{
+		__m256i v = _mm256_shuffle_epi8( _mm256_loadu_si256( ( const __m256i* ) ( value + i ) ), reverse );
+		__m256i hi = _mm256_and_si256( _mm256_srli_epi16( v, 4 ), low4 );
+		__m256i lo = _mm256_and_si256( v, low4 );
+		__m256i a = _mm256_shuffle_epi8( digits, _mm256_unpacklo_epi8( hi, lo ) );	// qwords i, i + 2
+		__m256i b = _mm256_shuffle_epi8( digits, _mm256_unpackhi_epi8( hi, lo ) );	// qwords i + 1, i + 3
+		_mm256_storeu_si256( ( __m256i* ) ( buffer + i * 16 ), _mm256_permute2x128_si256( a, b, 0x20 ) );
+		_mm256_storeu_si256( ( __m256i* ) ( buffer + i * 16 + 32 ), _mm256_permute2x128_si256( a, b, 0x31 ) );
+	};
+#else
+	// one qword per pass: nibble n becomes '0' + n, plus 7 more for n > 9 ( 'A' - '9' - 1 )
+	const __m128i low4 = _mm_set1_epi8( 0x0F );
+	const __m128i nine = _mm_set1_epi8( 9 );
+	for ( int i = 0; i < 8; i++ )
+	{
+		__m128i v = _mm_cvtsi64_si128( s64( _byteswap_uint64( value [ i ] ) ) );
+		__m128i hi = _mm_and_si128( _mm_srli_epi16( v, 4 ), low4 );
+		__m128i lo = _mm_and_si128( v, low4 );
+		__m128i n = _mm_unpacklo_epi8( hi, lo );
+		__m128i c = _mm_add_epi8( n, _mm_set1_epi8( '0' ) );
+		c = _mm_add_epi8( c, _mm_and_si128( _mm_cmpgt_epi8( n, nine ), _mm_set1_epi8( 7 ) ) );
+		_mm_storeu_si128( ( __m128i* ) ( buffer + i * 16 ), c );
+	};
+#endif
+	buffer [ ui512_hex_chars ] = 0;
+};
+
+s16 from_hex( u64* value, const char* text, int text_len )
+{
+	if ( text_len < 1 || text_len > ui512_hex_chars )
+	{
+		return -1;
+	};
+
+	// short text: right align in a zero filled copy
+	char padded [ ui512_hex_chars ];
+	const char* p = text;
+	if ( text_len < ui512_hex_chars )
+	{
+		std::memset( padded, '0', ui512_hex_chars - text_len );
+		std::memcpy( padded + ui512_hex_chars - text_len, text, text_len );
+		p = padded;
+	};
+
+	// per character: '0'-'9' to 0-9, 'A'-'F' ( case folded ) to 10-15, anything else invalid ( signed compares also reject bytes over 127 )
+	// then pairs of nibbles to bytes, most significant first, packed down and byte reversed into the qword
+#if defined( __ui512_fmt_Y )
+	for ( int i = 0; i < 8; i += 2 )
+	{
+		__m256i c = _mm256_loadu_si256( ( const __m256i* ) ( p + i * 16 ) );
+		__m256i is_d = _mm256_and_si256( _mm256_cmpgt_epi8( c, _mm256_set1_epi8( '0' - 1 ) ), _mm256_cmpgt_epi8( _mm256_set1_epi8( '9' + 1 ), c ) );
+		__m256i u = _mm256_and_si256( c, _mm256_set1_epi8( char( 0xDF ) ) );
+		__m256i is_a = _mm256_and_si256( _mm256_cmpgt_epi8( u, _mm256_set1_epi8( 'A' - 1 ) ), _mm256_cmpgt_epi8( _mm256_set1_epi8( 'F' + 1 ), u ) );
+		if ( _mm256_movemask_epi8( _mm256_or_si256( is_d, is_a ) ) != -1 )
+		{
+			return -1;
+		};
+		__m256i n = _mm256_or_si256(
+			_mm256_and_si256( is_d, _mm256_sub_epi8( c, _mm256_set1_epi8( '0' ) ) ),
+			_mm256_and_si256( is_a, _mm256_sub_epi8( u, _mm256_set1_epi8( 'A' - 10 ) ) ) );
+		__m256i w = _mm256_or_si256( _mm256_slli_epi16( _mm256_and_si256( n, _mm256_set1_epi16( 0x00FF ) ), 4 ), _mm256_srli_epi16( n, 8 ) );
+		__m256i b = _mm256_packus_epi16( w, w );
+		value [ i ] = _byteswap_uint64( u64( _mm256_extract_epi64( b, 0 ) ) );
+		value [ i + 1 ] = _byteswap_uint64( u64( _mm256_extract_epi64( b, 2 ) ) );
+	};
+#else
+	for ( int i = 0; i < 8; i++ )
+	{
+		__m128i c = _mm_loadu_si128( ( const __m128i* ) ( p + i * 16 ) );
+		__m128i is_d = _mm_and_si128( _mm_cmpgt_epi8( c, _mm_set1_epi8( '0' - 1 ) ), _mm_cmplt_epi8( c, _mm_set1_epi8( '9' + 1 ) ) );
+		__m128i u = _mm_and_si128( c, _mm_set1_epi8( char( 0xDF ) ) );
+		__m128i is_a = _mm_and_si128( _mm_cmpgt_epi8( u, _mm_set1_epi8( 'A' - 1 ) ), _mm_cmplt_epi8( u, _mm_set1_epi8( 'F' + 1 ) ) );
+		if ( _mm_movemask_epi8( _mm_or_si128( is_d, is_a ) ) != 0xFFFF )
+		{
+			return -1;
+		};
+		__m128i n = _mm_or_si128(
+			_mm_and_si128( is_d, _mm_sub_epi8( c, _mm_set1_epi8( '0' ) ) ),
+			_mm_and_si128( is_a, _mm_sub_epi8( u, _mm_set1_epi8( 'A' - 10 ) ) ) );
+		__m128i w = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( n, _mm_set1_epi16( 0x00FF ) ), 4 ), _mm_srli_epi16( n, 8 ) );
+		value [ i ] = _byteswap_uint64( u64( _mm_cvtsi128_si64( _mm_packus_epi16( w, w ) ) ) );
+	};
+#endif
+
+	return 0;
+};
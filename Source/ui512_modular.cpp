@@ -0,0 +1,872 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_modular
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_modular.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Modular exponentiation, built on the Montgomery context and the ui512 kernels. All intermediate values are in Montgomery form.
+//		Modular inverse by safegcd divsteps, in 62 bit signed limbs ( no kernels: the updates are mixed sign ).
+//		Batch inverse by Montgomery's trick, on the Montgomery context.
+//		GCD, binary and Lehmer, on the kernels.
+
+#include "ui512_modular.h"
+#include "ui512_externs.h"
+
+#include <immintrin.h>
+#include <intrin.h>
+
+static inline u64 exp_bit( const u64* exp, int i )
+{
+	return ( exp [ 7 - ( i >> 6 ) ] >> ( i & 63 ) ) & 1ull;
+};
+
+// masked swap of a, b when bit is one; no branch on bit
+static inline void cswap( u64* a, u64* b, u64 bit )
+{
+	u64 mask = 0ull - bit;
+	for ( int i = 0; i < 8; i++ )
+	{
+		u64 t = ( a [ i ] ^ b [ i ] ) & mask;
+		a [ i ] ^= t;
+		b [ i ] ^= t;
+	};
+};
+
+// window width by exponent length: balances the table ( 2^(w-1) multiplies ) against the multiplies saved
+static int auto_window( int bits )
+{
+	return ( bits < 8 ) ? 1 : ( bits < 24 ) ? 2 : ( bits < 80 ) ? 3 : ( bits < 240 ) ? 4 : 5;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Sliding window, left to right. table [ k ] = g^( 2k + 1 ). Each run of zero bits costs one square per bit; each window ( at most w bits,
+// starting and ending with a one ) costs one square per bit and one multiply.
+
+static void pow_window( u64* acc, const u64* g, const u64* exp, const mont_ctx* ctx, int w )
+{
+	int top = msb_u( exp );
+	if ( top < 0 )
+	{
+		copy_u( acc, ctx->r_mod_n );		// exp zero: one
+		return;
+	};
+	if ( w == 0 )
+	{
+		w = auto_window( top + 1 );
+	};
+
+	_UI512( table [ 1 << ( powmod_window_max - 1 ) ] );
+	_UI512( g2 ) { 0 };
+	copy_u( table [ 0 ], g );
+	mont_sqr( g2, g, ctx );
+	for ( int k = 1; k < ( 1 << ( w - 1 ) ); k++ )
+	{
+		mont_mul( table [ k ], table [ k - 1 ], g2, ctx );
+	};
+
+	bool first = true;
+	int i = top;
+	while ( i >= 0 )
+	{
+		if ( exp_bit( exp, i ) == 0 )
+		{
+			mont_sqr( acc, acc, ctx );
+			i--;
+			continue;
+		};
+
+		int low = ( i - w + 1 > 0 ) ? i - w + 1 : 0;
+		while ( exp_bit( exp, low ) == 0 )
+		{
+			low++;
+		};
+		u64 value = 0;
+		for ( int b = i; b >= low; b-- )
+		{
+			value = ( value << 1 ) | exp_bit( exp, b );
+		};
+
+		if ( first )
+		{
+			copy_u( acc, table [ value >> 1 ] );
+			first = false;
+		}
+		else
+		{
+			for ( int b = i; b >= low; b-- )
+			{
+				mont_sqr( acc, acc, ctx );
+			};
+			mont_mul( acc, acc, table [ value >> 1 ], ctx );
+		};
+		i = low - 1;
+	};
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Montgomery ladder: invariant r1 = r0 * g. All 512 bits, so the count of operations does not depend on the exponent either.
+
+static void pow_ladder( u64* acc, const u64* g, const u64* exp, const mont_ctx* ctx )
+{
+	_UI512( r0 ) { 0 };
+	_UI512( r1 ) { 0 };
+	copy_u( r0, ctx->r_mod_n );
+	copy_u( r1, g );
+	for ( int i = 511; i >= 0; i-- )
+	{
+		u64 bit = exp_bit( exp, i );
+		cswap( r0, r1, bit );
+		mont_mul( r1, r0, r1, ctx );
+		mont_sqr( r0, r0, ctx );
+		cswap( r0, r1, bit );
+	};
+	copy_u( acc, r0 );
+};
+
+s16 mont_pow( u64* result, const u64* base, const u64* exp, const mont_ctx* ctx, powmod_mode mode, int window )
+{
+	if ( window < 0 || window > powmod_window_max )
+	{
+		return -1;
+	};
+
+	_UI512( g ) { 0 };
+	_UI512( acc ) { 0 };
+	to_mont( g, base, ctx );
+	if ( mode == powmod_ladder )
+	{
+		pow_ladder( acc, g, exp, ctx );
+	}
+	else
+	{
+		pow_window( acc, g, exp, ctx, window );
+	};
+	from_mont( result, acc, ctx );
+
+	return 0;
+};
+
+s16 powmod_u( u64* result, const u64* base, const u64* exp, const u64* modulus, powmod_mode mode, int window )
+{
+	mont_ctx ctx;
+	if ( mont_init( &ctx, modulus ) != 0 )
+	{
+		return -1;
+	};
+	return mont_pow( result, base, exp, &ctx, mode, window );
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Modular inverse, safegcd: Bernstein & Yang divsteps, in batches of 62 on the low bits of f, g, each batch giving a 2x2 transition matrix
+// that is then applied to the full width values. Working values are signed, in nine 62 bit limbs, least significant first ( limbs 0-7 in
+// [0, 2^62), limb 8 signed ), so products and sums of the matrix updates fit a 128 bit accumulator.
+//
+//	f = modulus, g = a, d = 0, e = 1; invariants f = d * a, g = e * a ( mod modulus ); divsteps drive g to zero and f to +/- gcd.
+//	d, e are updated with the same matrix, divided by 2^62 mod modulus, and kept in ( -2 * modulus, modulus ).
+
+static const int s62_limbs = 9;
+static const u64 m62 = 0xFFFFFFFFFFFFFFFFull >> 2;
+
+// 1480 divsteps suffice for 512 bit inputs ( ( 49 * 512 + 57 ) / 17, Bernstein & Yang theorem 11.2 ): 24 batches of 62
+static const int divstep_batches = 24;
+
+struct signed62
+{
+	s64 v [ s62_limbs ];
+};
+
+struct trans62
+{
+	s64 u, v, q, r;
+};
+
+// signed 128 bit accumulator ( MSVC has no 128 bit integer type )
+struct acc128
+{
+	u64 lo;
+	s64 hi;
+};
+
+static inline void acc_mul_add( acc128* acc, s64 a, s64 b )
+{
+	s64 hi = 0;
+	u64 lo = u64( _mul128( a, b, &hi ) );
+	acc->lo += lo;
+	acc->hi += hi + ( acc->lo < lo );
+};
+
+static inline void acc_add( acc128* acc, s64 a )
+{
+	u64 lo = u64( a );
+	acc->lo += lo;
+	acc->hi += ( a >> 63 ) + ( acc->lo < lo );
+};
+
+// arithmetic shift right by 62
+static inline void acc_shr62( acc128* acc )
+{
+	acc->lo = ( acc->lo >> 62 ) | ( u64( acc->hi ) << 2 );
+	acc->hi >>= 62;
+};
+
+static void to_s62( signed62* s, const u64* a )
+{
+	for ( int i = 0; i < s62_limbs; i++ )
+	{
+		int bit = i * 62;
+		int w = bit >> 6;
+		int off = bit & 63;
+		u64 x = ( w < 8 ) ? a [ 7 - w ] >> off : 0ull;
+		if ( off > 2 && w + 1 < 8 )
+		{
+			x |= a [ 6 - w ] << ( 64 - off );
+		};
+		s->v [ i ] = s64( x & m62 );
+	};
+};
+
+// s non negative, less than 2^512, limbs in canonical form
+static void from_s62( u64* a, const signed62* s )
+{
+	zero_u( a );
+	for ( int i = 0; i < s62_limbs; i++ )
+	{
+		int bit = i * 62;
+		int w = bit >> 6;
+		int off = bit & 63;
+		u64 x = u64( s->v [ i ] );
+		if ( w < 8 )
+		{
+			a [ 7 - w ] |= x << off;
+		};
+		if ( off > 2 && w + 1 < 8 )
+		{
+			a [ 6 - w ] |= x >> ( 64 - off );
+		};
+	};
+};
+
+// 62 divsteps on the low bits, branch free. delta as in the paper; returns the updated delta.
+// Matrix t, scaled by 2^62: 2^62 * ( f', g' ) = t * ( f, g )
+static s64 divsteps_62( s64 delta, u64 f, u64 g, trans62* t )
+{
+	u64 u = 1, v = 0, q = 0, r = 1;
+	for ( int i = 0; i < 62; i++ )
+	{
+		// delta > 0 and g odd: ( f, g ) = ( g, -f ), delta = -delta
+		u64 c1 = 0ull - ( ( g & 1ull ) & ( u64( -delta ) >> 63 ) );
+		u64 x = ( f ^ g ) & c1;
+		f ^= x;
+		g ^= x;
+		g = ( g ^ c1 ) - c1;
+		x = ( u ^ q ) & c1;
+		u ^= x;
+		q ^= x;
+		q = ( q ^ c1 ) - c1;
+		x = ( v ^ r ) & c1;
+		v ^= x;
+		r ^= x;
+		r = ( r ^ c1 ) - c1;
+		delta = s64( ( u64( delta ) ^ c1 ) - c1 );
+
+		// g odd: g = g + f
+		u64 c2 = 0ull - ( g & 1ull );
+		g += f & c2;
+		q += u & c2;
+		r += v & c2;
+
+		delta++;
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	};
+	t->u = s64( u );
+	t->v = s64( v );
+	t->q = s64( q );
+	t->r = s64( r );
+	return delta;
+};
+
+// Variable time: runs of zero bits of g are skipped in one step ( tzcnt ), and the swap is a branch
+static s64 divsteps_62_var( s64 delta, u64 f, u64 g, trans62* t )
+{
+	u64 u = 1, v = 0, q = 0, r = 1;
+	int i = 62;
+	for ( ;; )
+	{
+		int zeros = int( _tzcnt_u64( g | ( 0xFFFFFFFFFFFFFFFFull << i ) ) );
+		g >>= zeros;
+		u <<= zeros;
+		v <<= zeros;
+		delta += zeros;
+		i -= zeros;
+		if ( i == 0 )
+		{
+			break;
+		};
+
+		// g odd
+		if ( delta > 0 )
+		{
+			delta = -delta;
+			u64 x = f;
+			f = g;
+			g = 0ull - x;
+			x = u;
+			u = q;
+			q = 0ull - x;
+			x = v;
+			v = r;
+			r = 0ull - x;
+		};
+		g += f;
+		q += u;
+		r += v;
+	};
+	t->u = s64( u );
+	t->v = s64( v );
+	t->q = s64( q );
+	t->r = s64( r );
+	return delta;
+};
+
+// ( f, g ) = t * ( f, g ) / 2^62, exact; first len limbs ( the top one signed )
+static void update_fg( signed62* f, signed62* g, const trans62* t, int len )
+{
+	acc128 cf = { 0, 0 };
+	acc128 cg = { 0, 0 };
+	acc_mul_add( &cf, t->u, f->v [ 0 ] );
+	acc_mul_add( &cf, t->v, g->v [ 0 ] );
+	acc_mul_add( &cg, t->q, f->v [ 0 ] );
+	acc_mul_add( &cg, t->r, g->v [ 0 ] );
+	acc_shr62( &cf );
+	acc_shr62( &cg );
+	for ( int i = 1; i < len; i++ )
+	{
+		acc_mul_add( &cf, t->u, f->v [ i ] );
+		acc_mul_add( &cf, t->v, g->v [ i ] );
+		acc_mul_add( &cg, t->q, f->v [ i ] );
+		acc_mul_add( &cg, t->r, g->v [ i ] );
+		f->v [ i - 1 ] = s64( cf.lo & m62 );
+		g->v [ i - 1 ] = s64( cg.lo & m62 );
+		acc_shr62( &cf );
+		acc_shr62( &cg );
+	};
+	f->v [ len - 1 ] = s64( cf.lo );
+	g->v [ len - 1 ] = s64( cg.lo );
+};
+
+// ( d, e ) = t * ( d, e ) / 2^62 mod modulus: a multiple of the modulus is added to clear the low 62 bits ( m_inv62 = modulus^-1 mod 2^62 ),
+// plus one modulus for each negative input, which keeps the results in ( -2 * modulus, modulus )
+static void update_de( signed62* d, signed62* e, const trans62* t, const signed62* m, u64 m_inv62 )
+{
+	const s64 sd = d->v [ s62_limbs - 1 ] >> 63;
+	const s64 se = e->v [ s62_limbs - 1 ] >> 63;
+	s64 md = ( t->u & sd ) + ( t->v & se );
+	s64 me = ( t->q & sd ) + ( t->r & se );
+
+	acc128 cd = { 0, 0 };
+	acc128 ce = { 0, 0 };
+	acc_mul_add( &cd, t->u, d->v [ 0 ] );
+	acc_mul_add( &cd, t->v, e->v [ 0 ] );
+	acc_mul_add( &ce, t->q, d->v [ 0 ] );
+	acc_mul_add( &ce, t->r, e->v [ 0 ] );
+	md -= s64( ( m_inv62 * cd.lo + u64( md ) ) & m62 );
+	me -= s64( ( m_inv62 * ce.lo + u64( me ) ) & m62 );
+	acc_mul_add( &cd, m->v [ 0 ], md );
+	acc_mul_add( &ce, m->v [ 0 ], me );
+	acc_shr62( &cd );
+	acc_shr62( &ce );
+	for ( int i = 1; i < s62_limbs; i++ )
+	{
+		acc_mul_add( &cd, t->u, d->v [ i ] );
+		acc_mul_add( &cd, t->v, e->v [ i ] );
+		acc_mul_add( &cd, m->v [ i ], md );
+		acc_mul_add( &ce, t->q, d->v [ i ] );
+		acc_mul_add( &ce, t->r, e->v [ i ] );
+		acc_mul_add( &ce, m->v [ i ], me );
+		d->v [ i - 1 ] = s64( cd.lo & m62 );
+		e->v [ i - 1 ] = s64( ce.lo & m62 );
+		acc_shr62( &cd );
+		acc_shr62( &ce );
+	};
+	d->v [ s62_limbs - 1 ] = s64( cd.lo );
+	e->v [ s62_limbs - 1 ] = s64( ce.lo );
+};
+
+// carry limbs 0-7 into canonical form
+static void carry62( signed62* s )
+{
+	for ( int i = 0; i < s62_limbs - 1; i++ )
+	{
+		s->v [ i + 1 ] += s->v [ i ] >> 62;
+		s->v [ i ] &= s64( m62 );
+	};
+};
+
+// d in ( -2 * modulus, modulus ) to ( d * sign ) mod modulus in [ 0, modulus ); masked, no branches on d
+static void normalize62( signed62* d, s64 sign, const signed62* m )
+{
+	s64 neg = d->v [ s62_limbs - 1 ] >> 63;
+	for ( int i = 0; i < s62_limbs; i++ )
+	{
+		d->v [ i ] += m->v [ i ] & neg;
+	};
+	carry62( d );
+	for ( int i = 0; i < s62_limbs; i++ )
+	{
+		d->v [ i ] = ( d->v [ i ] ^ sign ) - sign;
+	};
+	carry62( d );
+	neg = d->v [ s62_limbs - 1 ] >> 63;
+	for ( int i = 0; i < s62_limbs; i++ )
+	{
+		d->v [ i ] += m->v [ i ] & neg;
+	};
+	carry62( d );
+};
+
+// f ( first len limbs ) is +1 or -1: returns 0 or -1 ( the sign mask ) in *sign, and true; false for any other value
+static bool unit_sign( const signed62* f, int len, s64* sign )
+{
+	signed62 x = *f;
+	*sign = x.v [ len - 1 ] >> 63;
+	for ( int i = 0; i < len; i++ )
+	{
+		x.v [ i ] = ( x.v [ i ] ^ *sign ) - *sign;
+	};
+	for ( int i = 0; i < len - 1; i++ )
+	{
+		x.v [ i + 1 ] += x.v [ i ] >> 62;
+		x.v [ i ] &= s64( m62 );
+	};
+	s64 diff = x.v [ 0 ] ^ 1;
+	for ( int i = 1; i < len; i++ )
+	{
+		diff |= x.v [ i ];
+	};
+	return diff == 0;
+};
+
+// modulus^-1 mod 2^62, modulus odd: Newton, each step doubles the correct low bits ( 5 from m * m ^ 2 )
+static u64 inv62( u64 m )
+{
+	u64 x = ( m * 3 ) ^ 2;
+	for ( int i = 0; i < 4; i++ )
+	{
+		x *= 2 - m * x;
+	};
+	return x & m62;
+};
+
+s16 modinv_u( u64* result, const u64* a, const u64* modulus )
+{
+	if ( ( modulus [ 7 ] & 1ull ) == 0 )
+	{
+		return -1;
+	};
+
+	signed62 m, f, g, d, e;
+	to_s62( &m, modulus );
+	to_s62( &g, a );
+	f = m;
+	for ( int i = 0; i < s62_limbs; i++ )
+	{
+		d.v [ i ] = 0;
+		e.v [ i ] = 0;
+	};
+	e.v [ 0 ] = 1;
+	const u64 m_inv62 = inv62( modulus [ 7 ] );
+
+	// fixed count of batches, all at full width
+	s64 delta = 1;
+	trans62 t;
+	for ( int b = 0; b < divstep_batches; b++ )
+	{
+		delta = divsteps_62( delta, u64( f.v [ 0 ] ), u64( g.v [ 0 ] ), &t );
+		update_de( &d, &e, &t, &m, m_inv62 );
+		update_fg( &f, &g, &t, s62_limbs );
+	};
+
+	s64 sign = 0;
+	if ( !unit_sign( &f, s62_limbs, &sign ) )
+	{
+		return -1;
+	};
+	normalize62( &d, sign, &m );
+	from_s62( result, &d );
+
+	return 0;
+};
+
+s16 modinv_u_var( u64* result, const u64* a, const u64* modulus )
+{
+	if ( ( modulus [ 7 ] & 1ull ) == 0 )
+	{
+		return -1;
+	};
+
+	signed62 m, f, g, d, e;
+	to_s62( &m, modulus );
+	to_s62( &g, a );
+	f = m;
+	for ( int i = 0; i < s62_limbs; i++ )
+	{
+		d.v [ i ] = 0;
+		e.v [ i ] = 0;
+	};
+	e.v [ 0 ] = 1;
+	const u64 m_inv62 = inv62( modulus [ 7 ] );
+
+	// until g is zero; f, g shrink a limb at a time as their top limbs empty ( the next limb down then carries the sign )
+	s64 delta = 1;
+	int len = s62_limbs;
+	trans62 t;
+	for ( ;; )
+	{
+		delta = divsteps_62_var( delta, u64( f.v [ 0 ] ), u64( g.v [ 0 ] ), &t );
+		update_de( &d, &e, &t, &m, m_inv62 );
+		update_fg( &f, &g, &t, len );
+
+		s64 any = g.v [ 0 ];
+		for ( int i = 1; i < len; i++ )
+		{
+			any |= g.v [ i ];
+		};
+		if ( any == 0 )
+		{
+			break;
+		};
+
+		s64 fn = f.v [ len - 1 ];
+		s64 gn = g.v [ len - 1 ];
+		if ( len > 1 && ( ( fn ^ ( fn >> 63 ) ) | ( gn ^ ( gn >> 63 ) ) ) == 0 )
+		{
+			f.v [ len - 2 ] |= s64( u64( fn ) << 62 );
+			g.v [ len - 2 ] |= s64( u64( gn ) << 62 );
+			len--;
+		};
+	};
+
+	s64 sign = 0;
+	if ( !unit_sign( &f, len, &sign ) )
+	{
+		return -1;
+	};
+	normalize62( &d, sign, &m );
+	from_s62( result, &d );
+
+	return 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Batch inverse. Running products c [ i ] = c [ i - 1 ] * in [ i ] * R^-1 ( mont_mul on ordinary values ), starting from R mod N, so each
+// product carries one more factor R^-1 than the last; the inverse of the final product carries as many R. Unwinding, with inv the inverse
+// of c [ i ]:  in [ i ]^-1 = inv * c [ i - 1 ] * R^-1,  and the inverse of c [ i - 1 ] = inv * in [ i ] * R^-1 : the R factors cancel.
+// A value that is zero mod N zeroes its product ( the product so far is invertible ), so the running product is left as it was, and the
+// slot zeroed to mark it; running products are otherwise never zero.
+
+static inline bool is_zero( const u64* v )
+{
+	return compare_uT64( v, 0ull ) == 0;
+};
+
+// running products of in, skipping ( and zeroing ) values that are zero mod N, or fail check; returns the last product, or nullptr if none
+static const u64* batch_products( u64* c, const u64* in, int n, const mont_ctx* ctx, bool check )
+{
+	const u64* last = ctx->r_mod_n;
+	_UI512( t ) { 0 };
+	for ( int i = 0; i < n; i++ )
+	{
+		u64* ci = c + i * 8;
+		const u64* a = in + i * 8;
+		if ( check && modinv_u_var( t, a, ctx->modulus ) != 0 )
+		{
+			zero_u( ci );
+			continue;
+		};
+		mont_mul( ci, last, a, ctx );
+		if ( !is_zero( ci ) )
+		{
+			last = ci;
+		};
+	};
+	return ( last == ctx->r_mod_n ) ? nullptr : last;
+};
+
+int mont_batch_inv( u64* out, const u64* in, int n, const mont_ctx* ctx, u64* scratch )
+{
+	const u64* modulus = ctx->modulus;
+	if ( n <= 0 )
+	{
+		return 0;
+	};
+	if ( compare_uT64( modulus, 1ull ) == 0 )
+	{
+		for ( int i = 0; i < n; i++ )
+		{
+			zero_u( out + i * 8 );			// mod 1, every value is its own ( zero ) inverse
+		};
+		return 0;
+	};
+
+	u64* c = ( scratch != nullptr ) ? scratch : out;
+	_UI512( inv ) { 0 };
+	const u64* last = batch_products( c, in, n, ctx, false );
+	if ( last != nullptr && modinv_u( inv, last, modulus ) != 0 )
+	{
+		// some value shares a factor with the modulus: test them one by one, and start again without them
+		last = batch_products( c, in, n, ctx, true );
+		if ( last != nullptr )
+		{
+			modinv_u( inv, last, modulus );
+		};
+	};
+
+	// unwind, last value first; j walks down to the next value in the product
+	int bad = 0;
+	_UI512( t ) { 0 };
+	int i = n - 1;
+	while ( i >= 0 && is_zero( c + i * 8 ) )
+	{
+		zero_u( out + i * 8 );
+		bad++;
+		i--;
+	};
+	while ( i >= 0 )
+	{
+		int j = i - 1;
+		while ( j >= 0 && is_zero( c + j * 8 ) )
+		{
+			zero_u( out + j * 8 );
+			bad++;
+			j--;
+		};
+		if ( j < 0 )
+		{
+			copy_u( out + i * 8, inv );		// first value in the product: the product so far is just it
+			break;
+		};
+		mont_mul( t, inv, c + j * 8, ctx );
+		mont_mul( inv, inv, in + i * 8, ctx );
+		copy_u( out + i * 8, t );
+		i = j;
+	};
+
+	return bad;
+};
+
+int batch_modinv_u( u64* out, const u64* in, int n, const u64* modulus, u64* scratch )
+{
+	mont_ctx ctx;
+	if ( mont_init( &ctx, modulus ) != 0 )
+	{
+		return -1;
+	};
+	return mont_batch_inv( out, in, n, &ctx, scratch );
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// GCD
+
+// count of trailing zero bits ( 512 for zero ): lowest non zero limb, then tzcnt
+static inline int trailing_zeros( const u64* x )
+{
+	for ( int i = 7; i >= 0; i-- )
+	{
+		if ( x [ i ] != 0 )
+		{
+			return ( 7 - i ) * 64 + int( _tzcnt_u64( x [ i ] ) );
+		};
+	};
+	return 512;
+};
+
+// binary gcd of single qwords
+static u64 gcd64( u64 a, u64 b )
+{
+	if ( a == 0 || b == 0 )
+	{
+		return a | b;
+	};
+	u64 k = _tzcnt_u64( a | b );
+	a >>= _tzcnt_u64( a );
+	do
+	{
+		b >>= _tzcnt_u64( b );
+		if ( a > b )
+		{
+			u64 t = a;
+			a = b;
+			b = t;
+		};
+		b -= a;
+	} while ( b != 0 );
+	return a << k;
+};
+
+static inline bool fits64( const u64* x )
+{
+	return ( x [ 0 ] | x [ 1 ] | x [ 2 ] | x [ 3 ] | x [ 4 ] | x [ 5 ] | x [ 6 ] ) == 0;
+};
+
+s16 gcd_u( u64* result, const u64* a, const u64* b )
+{
+	_UI512( x ) { 0 };
+	_UI512( y ) { 0 };
+	copy_u( x, a );
+	copy_u( y, b );
+	int kx = trailing_zeros( x );
+	int ky = trailing_zeros( y );
+	if ( kx == 512 || ky == 512 )
+	{
+		or_u( result, x, y );		// either zero: the other
+		return 0;
+	};
+
+	// common factor of two set aside; then both odd, and the difference of two odd values is even
+	int k = ( kx < ky ) ? kx : ky;
+	shr_u( x, x, u16( kx ) );
+	shr_u( y, y, u16( ky ) );
+	u64* p = x;
+	u64* q = y;
+	for ( ;; )
+	{
+		if ( fits64( p ) && fits64( q ) )
+		{
+			set_uT64( p, gcd64( p [ 7 ], q [ 7 ] ) );
+			break;
+		};
+		s16 c = compare_u( p, q );
+		if ( c == 0 )
+		{
+			break;
+		};
+		if ( c > 0 )
+		{
+			u64* t = p;
+			p = q;
+			q = t;
+		};
+		sub_u( q, q, p );
+		shr_u( q, q, u16( trailing_zeros( q ) ) );
+	};
+	shl_u( result, p, u16( k ) );
+
+	return 0;
+};
+
+// the 62 bits of x from bit s up
+static inline u64 bits62( const u64* x, int s )
+{
+	int w = s >> 6;
+	int off = s & 63;
+	u64 v = x [ 7 - w ] >> off;
+	if ( off > 2 && w < 7 )
+	{
+		v |= x [ 6 - w ] << ( 64 - off );
+	};
+	return v & m62;
+};
+
+// dest = a * x + b * y, a and b of opposite signs ( or zero ), the result known to be non negative and under 2^512,
+// so the overflow qwords of the two products cancel, and the low 512 bits of the difference are the whole result
+static void cofactor_update( u64* dest, const u64* x, const u64* y, s64 a, s64 b )
+{
+	_UI512( px ) { 0 };
+	_UI512( py ) { 0 };
+	u64 ox = 0;
+	u64 oy = 0;
+	mult_uT64( px, &ox, x, u64( a < 0 ? -a : a ) );
+	mult_uT64( py, &oy, y, u64( b < 0 ? -b : b ) );
+	if ( b <= 0 )
+	{
+		sub_u( dest, px, py );
+	}
+	else
+	{
+		sub_u( dest, py, px );
+	};
+};
+
+s16 gcd_u_lehmer( u64* result, const u64* a, const u64* b )
+{
+	_UI512( buf [ 4 ] );
+	u64* x = buf [ 0 ];
+	u64* y = buf [ 1 ];
+	u64* t = buf [ 2 ];
+	u64* w = buf [ 3 ];
+	if ( compare_u( a, b ) >= 0 )
+	{
+		copy_u( x, a );
+		copy_u( y, b );
+	}
+	else
+	{
+		copy_u( x, b );
+		copy_u( y, a );
+	};
+
+	// x >= y throughout: cofactor updates give two consecutive remainders of Euclid's sequence, as does the division step
+	while ( compare_uT64( y, 0ull ) != 0 )
+	{
+		int mx = msb_u( x );
+		if ( mx < 64 )
+		{
+			set_uT64( x, gcd64( x [ 7 ], y [ 7 ] ) );
+			break;
+		};
+
+		// Algorithm L on the top 62 bits of x ( and the same bits of y ): quotients from both ends of the interval agree, or stop
+		int s = mx - 61;
+		s64 xh = s64( bits62( x, s ) );
+		s64 yh = s64( bits62( y, s ) );
+		s64 A = 1, B = 0, C = 0, D = 1;
+		while ( yh + C != 0 && yh + D != 0 )
+		{
+			s64 q = ( xh + A ) / ( yh + C );
+			if ( q != ( xh + B ) / ( yh + D ) )
+			{
+				break;
+			};
+			s64 T = A - q * C;
+			A = C;
+			C = T;
+			T = B - q * D;
+			B = D;
+			D = T;
+			T = xh - q * yh;
+			xh = yh;
+			yh = T;
+		};
+
+		if ( B == 0 )
+		{
+			// no certain quotient ( y much shorter than x ): one full division
+			div_u( t, w, x, y );
+			u64* r = x;
+			x = y;
+			y = w;
+			w = r;
+		}
+		else
+		{
+			cofactor_update( t, x, y, A, B );
+			cofactor_update( w, x, y, C, D );
+			u64* r = x;
+			x = t;
+			t = r;
+			r = y;
+			y = w;
+			w = r;
+		};
+	};
+	copy_u( result, x );
+
+	return 0;
+};
@@ -0,0 +1,118 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_montgomery
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_montgomery.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Montgomery context, conversion, multiply and square, built on the ui512 kernels.
+//		Division (div_u) is used once, in mont_init. The multiply / square path is mult_u ( sqr_u, mult_u_lo ), add_u, sub_u only.
+
+#include "ui512_montgomery.h"
+#include "ui512_externs.h"
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Montgomery reduction (REDC) of the 1024 bit value T = ( hi, lo ), T < NR. result = TR^-1 mod N
+//
+//	m = ( lo * N' ) mod R
+//	u = ( T + mN ) / R			the low half of T + mN is zero by construction of m; only its carry is kept
+//	u < 2N, so at most one subtraction of N. Done with a mask rather than a branch, so timing does not depend on the operands
+
+static void redc( u64* result, const u64* hi, const u64* lo, const mont_ctx* ctx )
+{
+	_UI512( m ) { 0 };
+	_UI512( mn_lo ) { 0 };
+	_UI512( mn_hi ) { 0 };
+	_UI512( u ) { 0 };
+	_UI512( s ) { 0 };
+	_UI512( discard ) { 0 };
+
+	mult_u_lo( m, lo, ctx->n_prime );
+	mult_u( mn_lo, mn_hi, m, ctx->modulus );
+	s16 carry = add_u( discard, lo, mn_lo );
+	s16 carry_out = add_u_wc( u, hi, mn_hi, carry );
+	s16 borrow = sub_u( s, u, ctx->modulus );
+
+	// take s ( = u - N ) if u overflowed 512 bits, or if u >= N (no borrow)
+	u64 mask = 0ull - u64( ( carry_out != 0 ) | ( borrow == 0 ) );
+	for ( int i = 0; i < 8; i++ )
+	{
+		result [ i ] = ( s [ i ] & mask ) | ( u [ i ] & ~mask );
+	};
+};
+
+s16 mont_init( mont_ctx* ctx, const u64* modulus )
+{
+	if ( ( modulus [ 7 ] & 1ull ) == 0 )
+	{
+		return -1;
+	};
+
+	copy_u( ctx->modulus, modulus );
+
+	// N^-1 mod R by Newton (Hensel) iteration: x = x( 2 - Nx ). For odd N, x = N is correct to 3 bits; each step doubles that.
+	_UI512( inv ) { 0 };
+	_UI512( t ) { 0 };
+	_UI512( two ) { 0 };
+	_UI512( discard ) { 0 };
+	copy_u( inv, modulus );
+	set_uT64( two, 2ull );
+	for ( int bits = 3; bits < 512; bits *= 2 )
+	{
+		mult_u_lo( t, modulus, inv );
+		sub_u( t, two, t );
+		mult_u_lo( inv, inv, t );
+	};
+	zero_u( t );
+	sub_u( ctx->n_prime, t, inv );
+
+	// R mod N = ( R - N ) mod N; R - N fits in 512 bits
+	_UI512( r_minus_n ) { 0 };
+	sub_u( r_minus_n, t, modulus );
+	div_u( discard, ctx->r_mod_n, r_minus_n, modulus );
+
+	// R^2 mod N: double R mod N, modulo N, 512 times
+	copy_u( t, ctx->r_mod_n );
+	for ( int i = 0; i < 512; i++ )
+	{
+		s16 carry = add_u( t, t, t );
+		if ( carry != 0 || compare_u( t, modulus ) >= 0 )
+		{
+			sub_u( t, t, modulus );
+		};
+	};
+	copy_u( ctx->r2_mod_n, t );
+
+	return 0;
+};
+
+void to_mont( u64* result, const u64* a, const mont_ctx* ctx )
+{
+	mont_mul( result, a, ctx->r2_mod_n, ctx );
+};
+
+void from_mont( u64* result, const u64* a, const mont_ctx* ctx )
+{
+	_UI512( zero ) { 0 };
+	redc( result, zero, a, ctx );
+};
+
+void mont_mul( u64* result, const u64* a, const u64* b, const mont_ctx* ctx )
+{
+	_UI512( lo ) { 0 };
+	_UI512( hi ) { 0 };
+	mult_u( lo, hi, a, b );
+	redc( result, hi, lo, ctx );
+};
+
+void mont_sqr( u64* result, const u64* a, const mont_ctx* ctx )
+{
+	_UI512( lo ) { 0 };
+	_UI512( hi ) { 0 };
+	sqr_u( lo, hi, a );
+	redc( result, hi, lo, ctx );
+};
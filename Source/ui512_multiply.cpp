@@ -0,0 +1,331 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_multiply
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_multiply.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Multiply variants that go with ui512_multiply.asm, written in C++ with intrinsics ( _umul128, _addcarry_u64 ):
+//		square, the low only / high only halves of the product, MULX / ADCX / ADOX versions of mult_u, mult_uT64, and four per call
+//		versions of mult_u ( two interleaved pairs ) and div_uT64 ( all four interleaved ).
+//		Same signatures, semantics and limb order ( [0] most significant ) as the assembler kernels, and extern "C", so an assembler
+//		version can replace any of them without changing callers.
+//		Internally the qwords are worked least significant first: a [ i ] = multiplicand [ 7 - i ].
+
+#include "ui512_externs.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <immintrin.h>
+#include <intrin.h>
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Column ( product scanning ) accumulation: all products a[i] * b[j] with i + j == k are summed into a three qword accumulator,
+// the low qword is the column result, and the accumulator shifts down one qword for the next column.
+
+static inline void mul_acc( u64& c0, u64& c1, u64& c2, u64 x, u64 y )
+{
+	u64 hi = 0;
+	u64 lo = _umul128( x, y, &hi );
+	unsigned char c = _addcarry_u64( 0, c0, lo, &c0 );
+	c = _addcarry_u64( c, c1, hi, &c1 );
+	c2 += c;
+};
+
+// columns first to 15 of a * b into t [ first .. 15 ], least significant first
+static void mul_columns( u64* t, const u64* a, const u64* b, int first )
+{
+	u64 c0 = 0, c1 = 0, c2 = 0;
+	for ( int k = first; k < 16; k++ )
+	{
+		int lo = ( k < 8 ) ? 0 : k - 7;
+		int hi = ( k < 8 ) ? k : 7;
+		for ( int i = lo; i <= hi; i++ )
+		{
+			mul_acc( c0, c1, c2, a [ i ], b [ k - i ] );
+		};
+		t [ k ] = c0;
+		c0 = c1;
+		c1 = c2;
+		c2 = 0;
+	};
+};
+
+s16 sqr_u( u64* product, u64* overflow, const u64* multiplicand )
+{
+	u64 a [ 8 ];
+	u64 t [ 16 ] = { 0 };
+	for ( int i = 0; i < 8; i++ )
+	{
+		a [ i ] = multiplicand [ 7 - i ];
+	};
+
+	// cross products a[i] * a[j], i < j, each once: 28 multiplies
+	for ( int i = 0; i < 7; i++ )
+	{
+		u64 carry = 0;
+		for ( int j = i + 1; j < 8; j++ )
+		{
+			u64 hi = 0;
+			u64 lo = _umul128( a [ i ], a [ j ], &hi );
+			hi += _addcarry_u64( 0, t [ i + j ], lo, &t [ i + j ] );
+			hi += _addcarry_u64( 0, t [ i + j ], carry, &t [ i + j ] );
+			carry = hi;
+		};
+		t [ i + 8 ] = carry;
+	};
+
+	// double them
+	for ( int k = 15; k > 0; k-- )
+	{
+		t [ k ] = ( t [ k ] << 1 ) | ( t [ k - 1 ] >> 63 );
+	};
+	t [ 0 ] <<= 1;
+
+	// add the squares a[i] * a[i]: 8 multiplies, one carry chain
+	unsigned char c = 0;
+	for ( int i = 0; i < 8; i++ )
+	{
+		u64 hi = 0;
+		u64 lo = _umul128( a [ i ], a [ i ], &hi );
+		c = _addcarry_u64( c, t [ 2 * i ], lo, &t [ 2 * i ] );
+		c = _addcarry_u64( c, t [ 2 * i + 1 ], hi, &t [ 2 * i + 1 ] );
+	};
+
+	for ( int i = 0; i < 8; i++ )
+	{
+		product [ 7 - i ] = t [ i ];
+		overflow [ 7 - i ] = t [ i + 8 ];
+	};
+
+	return 0;
+};
+
+s16 mult_u_lo( u64* product, const u64* multiplicand, const u64* multiplier )
+{
+	u64 a [ 8 ], b [ 8 ], t [ 8 ];
+	for ( int i = 0; i < 8; i++ )
+	{
+		a [ i ] = multiplicand [ 7 - i ];
+		b [ i ] = multiplier [ 7 - i ];
+	};
+
+	// columns 0 to 6 in full: 28 multiplies
+	u64 c0 = 0, c1 = 0, c2 = 0;
+	for ( int k = 0; k < 7; k++ )
+	{
+		for ( int i = 0; i <= k; i++ )
+		{
+			mul_acc( c0, c1, c2, a [ i ], b [ k - i ] );
+		};
+		t [ k ] = c0;
+		c0 = c1;
+		c1 = c2;
+		c2 = 0;
+	};
+
+	// column 7: low qwords only, nothing above it is kept
+	for ( int i = 0; i < 8; i++ )
+	{
+		c0 += a [ i ] * b [ 7 - i ];
+	};
+	t [ 7 ] = c0;
+
+	for ( int i = 0; i < 8; i++ )
+	{
+		product [ 7 - i ] = t [ i ];
+	};
+
+	return 0;
+};
+
+s16 mult_u_hi( u64* overflow, const u64* multiplicand, const u64* multiplier )
+{
+	u64 a [ 8 ], b [ 8 ], t [ 16 ];
+	for ( int i = 0; i < 8; i++ )
+	{
+		a [ i ] = multiplicand [ 7 - i ];
+		b [ i ] = multiplier [ 7 - i ];
+	};
+
+	// Columns 6 to 15 only: 43 multiplies. The 21 products left out ( i + j <= 5 ) are each below 2^448, so together they add
+	// less than 21 to column 7, and can carry into the high half only if column 7 is within 21 of overflowing.
+	// Then ( rarely ) do the full product.
+	mul_columns( t, a, b, 6 );
+	if ( t [ 7 ] > u64_Max - 21 )
+	{
+		mul_columns( t, a, b, 0 );
+	};
+
+	for ( int i = 0; i < 8; i++ )
+	{
+		overflow [ 7 - i ] = t [ i + 8 ];
+	};
+
+	return 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// MULX leaves the flags alone, so the low qwords of a row of products are added in on one carry chain ( CF, ADCX ) while the high qwords
+// go in on another ( OF, ADOX ), rather than each product waiting on one propagating carry.
+// Outputs are const u64*, as the assembler prototypes, so these fit the kernel table; the caller's arrays are not const.
+
+s16 mult_uT64_adx( const u64* product, const u64* overflow, const u64* multiplicand, const u64 multiplier )
+{
+	u64* p = const_cast< u64* >( product );
+	u64 carry = 0;
+	unsigned char cf = 0;
+	for ( int j = 7; j >= 0; j-- )
+	{
+		unsigned long long hi = 0;
+		u64 lo = _mulx_u64( multiplicand [ j ], multiplier, &hi );
+		cf = _addcarryx_u64( cf, lo, carry, &p [ j ] );
+		carry = hi;
+	};
+	*const_cast< u64* >( overflow ) = carry + cf;
+
+	return 0;
+};
+
+s16 mult_u_adx( const u64* product, const u64* overflow, const u64* multiplicand, const u64* multiplier )
+{
+	u64 a [ 8 ], b [ 8 ];
+	u64 t [ 16 ] = { 0 };
+	for ( int i = 0; i < 8; i++ )
+	{
+		a [ i ] = multiplicand [ 7 - i ];
+		b [ i ] = multiplier [ 7 - i ];
+	};
+
+	// one row per multiplier qword: t += a * b[i] << 64i
+	for ( int i = 0; i < 8; i++ )
+	{
+		unsigned char cf = 0;
+		unsigned char of = 0;
+		for ( int j = 0; j < 8; j++ )
+		{
+			unsigned long long hi = 0;
+			u64 lo = _mulx_u64( a [ j ], b [ i ], &hi );
+			cf = _addcarryx_u64( cf, t [ i + j ], lo, &t [ i + j ] );
+			of = _addcarryx_u64( of, t [ i + j + 1 ], hi, &t [ i + j + 1 ] );
+		};
+		t [ i + 8 ] += cf;		// t [ i + 8 ] was zero before this row, so the OF chain ends with no carry, and this can not overflow
+	};
+
+	u64* p = const_cast< u64* >( product );
+	u64* o = const_cast< u64* >( overflow );
+	for ( int i = 0; i < 8; i++ )
+	{
+		p [ 7 - i ] = t [ i ];
+		o [ 7 - i ] = t [ i + 8 ];
+	};
+
+	return 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Four per call: one mult_u ( div_uT64 ) is a single dependent chain, each step waiting on the last multiply ( divide ) and carry,
+// while the multiplier sits idle much of the time. Here each step is taken for several independent operations in turn ( multiply:
+// two, a pair at a time; divide: all four ), so their chains are in flight together and the out of order core overlaps them.
+// Same arithmetic and limb order as the single versions.
+// Division gains only as far as the core pipelines its divider: little on recent cores, where a DIV issues about as often as it completes.
+// Operands are all read into locals first and results stored last, so any output may overlap any input.
+
+// t [ k ] += x * y + carry, the high qword to carry: at most ( 2^64 - 1 )^2 + 2 ( 2^64 - 1 ) = 2^128 - 1, so it can not overflow
+static inline void row_acc( u64& carry, u64& t, u64 x, u64 y )
+{
+	u64 hi = 0;
+	u64 lo = _umul128( x, y, &hi );
+	unsigned char c = _addcarry_u64( 0, lo, t, &lo );
+	hi += c;
+	c = _addcarry_u64( 0, lo, carry, &t );
+	carry = hi + c;
+};
+
+// rows ( operand scanning ) of two products at once, a row per multiplicand qword: t += a [ i ] * b << 64i, s += e [ i ] * f << 64i.
+// Two carries are what the registers hold beside the operands; four chains were measured slower, spilling their carries to memory.
+static void mul_rows_x2( u64* t, u64* s, const u64* a, const u64* b, const u64* e, const u64* f )
+{
+	std::fill_n( t, 16, 0ull );
+	std::fill_n( s, 16, 0ull );
+	for ( int i = 0; i < 8; i++ )
+	{
+		u64 c = 0, d = 0;
+		for ( int j = 0; j < 8; j++ )
+		{
+			row_acc( c, t [ i + j ], a [ i ], b [ j ] );
+			row_acc( d, s [ i + j ], e [ i ], f [ j ] );
+		};
+		t [ i + 8 ] = c;
+		s [ i + 8 ] = d;
+	};
+};
+
+s16 mult_u_x4( u64* const products [ 4 ], u64* const overflows [ 4 ], const u64* const multiplicands [ 4 ], const u64* const multipliers [ 4 ] )
+{
+	u64 a [ 4 ] [ 8 ], b [ 4 ] [ 8 ], t [ 4 ] [ 16 ];
+	for ( int n = 0; n < 4; n++ )
+	{
+		for ( int i = 0; i < 8; i++ )
+		{
+			a [ n ] [ i ] = multiplicands [ n ] [ 7 - i ];
+			b [ n ] [ i ] = multipliers [ n ] [ 7 - i ];
+		};
+	};
+
+	mul_rows_x2( t [ 0 ], t [ 1 ], a [ 0 ], b [ 0 ], a [ 1 ], b [ 1 ] );
+	mul_rows_x2( t [ 2 ], t [ 3 ], a [ 2 ], b [ 2 ], a [ 3 ], b [ 3 ] );
+
+	for ( int n = 0; n < 4; n++ )
+	{
+		for ( int i = 0; i < 8; i++ )
+		{
+			products [ n ] [ 7 - i ] = t [ n ] [ i ];
+			overflows [ n ] [ 7 - i ] = t [ n ] [ i + 8 ];
+		};
+	};
+
+	return 0;
+};
+
+s16 div_uT64_x4( u64* const quotients [ 4 ], u64* const remainders [ 4 ], const u64* const dividends [ 4 ], const u64 divisors [ 4 ] )
+{
+	u64 q [ 4 ] [ 8 ], r [ 4 ] = { 0 }, d [ 4 ];
+	u32 zero_lanes = 0;												// bit n: lane n's divisor is zero; the divisors are not read again,
+	s16 retcode = 0;												// outputs may overlap them
+	for ( int n = 0; n < 4; n++ )
+	{
+		zero_lanes |= ( divisors [ n ] == 0 ) ? 1u << n : 0u;
+		d [ n ] = ( divisors [ n ] == 0 ) ? 1 : divisors [ n ];		// a zero divisor's lane is divided by one, then zeroed
+	};
+
+	// most significant qword first, the remainder carried down into the next; r < d, so no quotient qword overflows
+	for ( int j = 0; j < 8; j++ )
+	{
+		for ( int n = 0; n < 4; n++ )
+		{
+			q [ n ] [ j ] = _udiv128( r [ n ], dividends [ n ] [ j ], d [ n ], &r [ n ] );
+		};
+	};
+
+	for ( int n = 0; n < 4; n++ )
+	{
+		if ( zero_lanes & ( 1u << n ) )
+		{
+			std::fill_n( q [ n ], 8, 0ull );
+			r [ n ] = 0;
+			retcode = -1;
+		};
+		for ( int j = 0; j < 8; j++ )
+		{
+			quotients [ n ] [ j ] = q [ n ] [ j ];
+		};
+		*remainders [ n ] = r [ n ];
+	};
+
+	return retcode;
+};
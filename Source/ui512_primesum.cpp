@@ -0,0 +1,969 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_primesum
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_primesum.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Segmented, wheel factored sieve; sums in registers, totals in a sharded ui512_accumulator.
+//		Byte i of the sieve is the run 30i to 30i + 29, bit k the number 30i + residue [ k ]. For a prime p = 30a + b and a multiplier
+//		q coprime to 30, the multiples p * q step through the wheel: the next multiplier is q + gap, which moves a * gap bytes plus a
+//		carry that depends only on b and the wheel position of q ( the adv table ), and strikes a bit that depends only on the same two.
+
+#include "ui512_primesum.h"
+#include "ui512_accumulator.h"
+#include "ui512_externs.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <immintrin.h>
+#include <intrin.h>
+
+static const int seg_bytes = primesum_segment_bytes;
+static const int presieve_bytes = 7 * 11 * 13;			// pattern repeats every 1001 bytes ( 30030 numbers )
+static const u32 first_sieving = 17;					// 2, 3, 5 by the wheel, 7, 11, 13 by the pattern
+
+// the numbers coprime to 30, one per bit; the multiplier step from each to the next
+static const u32 residue [ 8 ] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+static const u32 gap [ 8 ] = { 6, 4, 2, 4, 2, 4, 6, 2 };
+
+struct wheel_tables
+{
+	s16 bit_of [ 30 ];							// residue to bit, -1 if not coprime to 30
+	u8 next [ 30 ];								// r to the wheel position of the first residue >= r
+	u8 adv [ 8 ] [ 8 ];							// [ bit of p mod 30 ] [ wheel position of q ]: carry bytes of a step
+	u8 keep [ 8 ] [ 8 ];						// same: mask that strikes p * q
+	u8 presieve [ presieve_bytes ];
+};
+
+static wheel_tables build_tables( )
+{
+	wheel_tables built;
+	wheel_tables* t = &built;
+	for ( int r = 0; r < 30; r++ )
+	{
+		t->bit_of [ r ] = -1;
+	};
+	for ( int k = 0; k < 8; k++ )
+	{
+		t->bit_of [ residue [ k ] ] = s16( k );
+	};
+	for ( int r = 0, k = 0; r < 30; r++ )
+	{
+		while ( residue [ k ] < u32( r ) )
+		{
+			k++;
+		};
+		t->next [ r ] = u8( k );
+	};
+	for ( int pb = 0; pb < 8; pb++ )
+	{
+		u32 b = residue [ pb ];
+		for ( int w = 0; w < 8; w++ )
+		{
+			u32 br = ( b * residue [ w ] ) % 30;
+			t->adv [ pb ] [ w ] = u8( ( br + b * gap [ w ] ) / 30 );
+			t->keep [ pb ] [ w ] = u8( ~( 1u << t->bit_of [ br ] ) );
+		};
+	};
+	for ( int i = 0; i < presieve_bytes; i++ )
+	{
+		u8 byte = 0xFF;
+		for ( int k = 0; k < 8; k++ )
+		{
+			u64 n = u64( i ) * 30 + residue [ k ];
+			if ( n % 7 == 0 || n % 11 == 0 || n % 13 == 0 )
+			{
+				byte &= u8( ~( 1u << k ) );
+			};
+		};
+		t->presieve [ i ] = byte;
+	};
+	return built;
+};
+
+static const wheel_tables* tables( )
+{
+	static const wheel_tables t = build_tables( );		// once, on first use
+	return &t;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Sieving primes
+
+// a prime with several strikes per segment: its next strike, as a byte offset from the chunk start and a wheel position
+struct small_prime
+{
+	u64 pos;
+	u32 step;									// p / 30
+	u8 pb;										// bit of p mod 30
+	u8 wi;
+};
+
+// a bucketed prime: offset in the bucket's segment ( low 16 bits ) and wheel position ( above )
+struct bucket_entry
+{
+	u32 prime;
+	u32 at;
+};
+
+// first multiple p * q >= max( start, p * p ), q coprime to 30; q's wheel position to wi
+static u64 first_multiple( u32 p, u64 start, u8* wi, const wheel_tables* t )
+{
+	u64 q = ( start + p - 1 ) / p;
+	if ( q < p )
+	{
+		q = p;
+	};
+	u32 r = u32( q % 30 );
+	u8 k = t->next [ r ];
+	*wi = k;
+	return u64( p ) * ( q - r + residue [ k ] );
+};
+
+// odd primes first_sieving to root, by a plain sieve ( root is at most 2^24 )
+static void sieving_primes( std::vector<u32>* primes, u32 root )
+{
+	std::vector<u8> composite( root / 2 + 1, 0 );
+	for ( u32 i = 3; u64( i ) * i <= root; i += 2 )
+	{
+		if ( !composite [ i / 2 ] )
+		{
+			for ( u32 j = i * i; j <= root; j += 2 * i )
+			{
+				composite [ j / 2 ] = 1;
+			};
+		};
+	};
+	for ( u32 i = first_sieving; i <= root; i += 2 )
+	{
+		if ( !composite [ i / 2 ] )
+		{
+			primes->push_back( i );
+		};
+	};
+};
+
+// floor( sqrt( n ) ), n under 2^52 ( the double is then within one of the root )
+static u64 root_of( u64 n )
+{
+	u64 root = u64( std::sqrt( double( n ) ) );
+	while ( root * root > n )
+	{
+		root--;
+	};
+	while ( ( root + 1 ) * ( root + 1 ) <= n )
+	{
+		root++;
+	};
+	return root;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Work ranges: chunk indexes [ front, back ), packed in one word ( front low, back high ); the owner takes the front, thieves the back
+
+struct alignas( 64 ) work_range
+{
+	std::atomic<u64> range;
+	u64 steals;
+	u64 primes;
+	u8 pad [ 64 - sizeof( std::atomic<u64> ) - 2 * sizeof( u64 ) ];
+};
+
+static inline u64 pack_range( u64 front, u64 back )
+{
+	return front | ( back << 32 );
+};
+
+static bool take_front( work_range* w, u64* chunk )
+{
+	u64 r = w->range.load( std::memory_order_relaxed );
+	for ( ;; )
+	{
+		u64 front = r & 0xFFFFFFFFull;
+		u64 back = r >> 32;
+		if ( front >= back )
+		{
+			return false;
+		};
+		if ( w->range.compare_exchange_weak( r, pack_range( front + 1, back ), std::memory_order_acq_rel ) )
+		{
+			*chunk = front;
+			return true;
+		};
+	};
+};
+
+static bool take_back( work_range* w, u64* chunk )
+{
+	u64 r = w->range.load( std::memory_order_relaxed );
+	for ( ;; )
+	{
+		u64 front = r & 0xFFFFFFFFull;
+		u64 back = r >> 32;
+		if ( front >= back )
+		{
+			return false;
+		};
+		if ( w->range.compare_exchange_weak( r, pack_range( front, back - 1 ), std::memory_order_acq_rel ) )
+		{
+			*chunk = back - 1;
+			return true;
+		};
+	};
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// One job, shared by the workers ( read only, but for the ranges, the accumulator and the results )
+
+// a finished chunk's sum and count, published ( done ) for the checkpoint writer
+struct chunk_result
+{
+	u64 hi;
+	u64 lo;
+	u64 primes;
+	std::atomic<u32> done;
+};
+
+struct sieve_job
+{
+	u64 limit;
+	u64 total_bytes;							// limit / 30 + 1
+	u64 chunk_bytes;							// a whole number of segments
+	u64 chunks;
+	std::vector<u32> primes;					// sieving primes, ascending
+	size_t small_count;							// primes [ 0, small_count ) are small, the rest bucketed
+	u64 ring;									// bucket count, a power of two
+	std::vector<u32> todo;						// chunks to sieve; the work ranges index this
+	work_range* work;
+	int threads;
+	ui512_accumulator acc;
+	chunk_result* results;						// per chunk, or nullptr when not checkpointing
+	const std::atomic<bool>* stop;				// no new chunks once set, or nullptr
+};
+
+// per thread buffers, kept across chunks
+struct sieve_worker
+{
+	alignas( 64 ) u8 seg [ seg_bytes ];
+	std::vector<small_prime> small;
+	std::vector<std::vector<bucket_entry>> buckets;
+};
+
+// 128 bit sum ( hi, lo ) += x
+static inline void add128( u64* hi, u64* lo, u64 x_hi, u64 x_lo )
+{
+	unsigned char c = _addcarry_u64( 0, *lo, x_lo, ( unsigned long long* ) lo );
+	_addcarry_u64( c, *hi, x_hi, ( unsigned long long* ) hi );
+};
+
+// sum and count of the primes left in a sieved segment starting at global byte g; bytes beyond len must be zero ( to the next qword )
+static void sum_segment( const u8* seg, int len, u64 g, u64* hi, u64* lo, u64* count )
+{
+	u64 n = 0;
+	u64 bytes = 0;
+	u64 residues = 0;
+	for ( int o = 0; o < len; o += 8 )
+	{
+		u64 w = 0;
+		std::memcpy( &w, seg + o, 8 );
+		while ( w != 0 )
+		{
+			u64 k = _tzcnt_u64( w );
+			n++;
+			bytes += u64( o ) + ( k >> 3 );
+			residues += residue [ k & 7 ];
+			w &= w - 1;
+		};
+	};
+
+	// sum = 30 * ( n * g + bytes ) + residues; n * g is under 2^62 ( g < 2^44, n < 2^18 )
+	u64 s_hi = 0;
+	u64 s_lo = _umul128( n * g + bytes, 30, &s_hi );
+	add128( &s_hi, &s_lo, 0, residues );
+	add128( hi, lo, s_hi, s_lo );
+	*count += n;
+};
+
+static void sieve_chunk( sieve_job* job, sieve_worker* wk, u64 chunk, u64* hi, u64* lo, u64* count )
+{
+	const wheel_tables* t = tables( );
+	const u64 b0 = chunk * job->chunk_bytes;
+	const u64 len = ( job->total_bytes - b0 < job->chunk_bytes ) ? job->total_bytes - b0 : job->chunk_bytes;
+	const u64 start = b0 * 30;
+	const u64 mask = job->ring - 1;
+
+	// small primes: first strike at or after the chunk start
+	wk->small.resize( job->small_count );
+	for ( size_t i = 0; i < job->small_count; i++ )
+	{
+		u32 p = job->primes [ i ];
+		small_prime* sp = &wk->small [ i ];
+		sp->pos = first_multiple( p, start, &sp->wi, t ) / 30 - b0;
+		sp->step = p / 30;
+		sp->pb = u8( t->bit_of [ p % 30 ] );
+	};
+
+	// large primes: bucketed as the segments reach them ( by p * p, ascending, which bounds the first strike to the bucket ring )
+	for ( u64 i = 0; i < job->ring; i++ )
+	{
+		wk->buckets [ i ].clear( );
+	};
+	size_t next_large = job->small_count;
+
+	for ( u64 seg_lo = 0; seg_lo < len; seg_lo += seg_bytes )
+	{
+		u8* seg = wk->seg;
+		const int seg_len = int( ( len - seg_lo < u64( seg_bytes ) ) ? len - seg_lo : u64( seg_bytes ) );
+		const u64 g = b0 + seg_lo;
+		const u64 s = seg_lo / seg_bytes;
+
+		// pattern copy: 7, 11, 13 struck out
+		int at = int( g % presieve_bytes );
+		for ( int filled = 0; filled < seg_len; )
+		{
+			int n = presieve_bytes - at;
+			if ( n > seg_len - filled )
+			{
+				n = seg_len - filled;
+			};
+			std::memcpy( seg + filled, t->presieve + at, n );
+			filled += n;
+			at = 0;
+		};
+		if ( g == 0 )
+		{
+			seg [ 0 ] &= 0xFE;		// 1 is not prime
+		};
+
+		// small primes: strike until past the segment
+		const u64 seg_hi = seg_lo + u64( seg_len );
+		for ( small_prime& sp : wk->small )
+		{
+			u64 pos = sp.pos;
+			u32 wi = sp.wi;
+			const u64 step = sp.step;
+			const u8* adv = t->adv [ sp.pb ];
+			const u8* keep = t->keep [ sp.pb ];
+			while ( pos < seg_hi )
+			{
+				seg [ pos - seg_lo ] &= keep [ wi ];
+				pos += step * gap [ wi ] + adv [ wi ];
+				wi = ( wi + 1 ) & 7;
+			};
+			sp.pos = pos;
+			sp.wi = u8( wi );
+		};
+
+		// large primes whose first strike comes within reach of the ring
+		const u64 reach = seg_lo + ( job->ring - 1 ) * u64( seg_bytes );
+		while ( next_large < job->primes.size( ) )
+		{
+			u32 p = job->primes [ next_large ];
+			if ( u64( p ) * p / 30 >= b0 + reach )
+			{
+				break;
+			};
+			u8 wi = 0;
+			u64 pos = first_multiple( p, start, &wi, t ) / 30 - b0;
+			if ( pos < len )
+			{
+				bucket_entry e = { p, u32( pos % seg_bytes ) | ( u32( wi ) << 16 ) };
+				wk->buckets [ ( pos / seg_bytes ) & mask ].push_back( e );
+			};
+			next_large++;
+		};
+
+		// this segment's bucket: strike, then file each prime under the segment of its next strike
+		std::vector<bucket_entry>& bucket = wk->buckets [ s & mask ];
+		for ( const bucket_entry& e : bucket )
+		{
+			const u32 p = e.prime;
+			const u64 step = p / 30;
+			const int pb = t->bit_of [ p % 30 ];
+			u64 off = e.at & 0xFFFF;
+			u32 wi = e.at >> 16;
+			do
+			{
+				seg [ off ] &= t->keep [ pb ] [ wi ];
+				off += step * gap [ wi ] + t->adv [ pb ] [ wi ];
+				wi = ( wi + 1 ) & 7;
+			} while ( off < u64( seg_len ) );
+			u64 pos = seg_lo + off;
+			if ( pos < len )
+			{
+				bucket_entry n = { p, u32( pos % seg_bytes ) | ( wi << 16 ) };
+				wk->buckets [ ( pos / seg_bytes ) & mask ].push_back( n );
+			};
+		};
+		bucket.clear( );
+
+		// last byte of the whole range: residues above the limit
+		if ( g + u64( seg_len ) == job->total_bytes )
+		{
+			u32 top = u32( job->limit % 30 );
+			for ( int k = 0; k < 8; k++ )
+			{
+				if ( residue [ k ] > top )
+				{
+					seg [ seg_len - 1 ] &= u8( ~( 1u << k ) );
+				};
+			};
+		};
+
+		int padded = ( seg_len + 7 ) & ~7;
+		std::memset( seg + seg_len, 0, size_t( padded - seg_len ) );
+		sum_segment( seg, padded, g, hi, lo, count );
+	};
+};
+
+static void sieve_worker_run( sieve_job* job, int self )
+{
+	sieve_worker* wk = new sieve_worker;
+	wk->buckets.resize( size_t( job->ring ) );
+	work_range* mine = &job->work [ self ];
+
+	u64 at = 0;
+	for ( ;; )
+	{
+		if ( job->stop != nullptr && job->stop->load( std::memory_order_relaxed ) )
+		{
+			break;
+		};
+		if ( !take_front( mine, &at ) )
+		{
+			// steal: the others in turn, from the back ( the work furthest from the owner )
+			bool found = false;
+			for ( int i = 1; i < job->threads && !found; i++ )
+			{
+				found = take_back( &job->work [ ( self + i ) % job->threads ], &at );
+			};
+			if ( !found )
+			{
+				break;
+			};
+			mine->steals++;
+		};
+
+		u64 chunk = job->todo [ size_t( at ) ];
+		u64 hi = 0;
+		u64 lo = 0;
+		u64 count = 0;
+		sieve_chunk( job, wk, chunk, &hi, &lo, &count );
+
+		_UI512( partial ) { 0 };
+		partial [ 6 ] = hi;
+		partial [ 7 ] = lo;
+		acc_add_u( &job->acc, self, partial );
+		mine->primes += count;
+		if ( job->results != nullptr )
+		{
+			chunk_result* r = &job->results [ chunk ];
+			r->hi = hi;
+			r->lo = lo;
+			r->primes = count;
+			r->done.store( 1, std::memory_order_release );
+		};
+	};
+
+	delete wk;
+};
+
+// sieving primes and bucket ring for limit
+static void plan_primes( sieve_job* job, u64 limit )
+{
+	job->limit = limit;
+	job->total_bytes = limit / 30 + 1;
+	job->results = nullptr;
+	job->stop = nullptr;
+
+	sieving_primes( &job->primes, u32( root_of( limit ) ) );
+	job->small_count = 0;
+	while ( job->small_count < job->primes.size( ) && job->primes [ job->small_count ] < u32( seg_bytes ) )
+	{
+		job->small_count++;
+	};
+
+	// ring: a strike moves at most 6p / 30 + 6 bytes, a first strike at most 7p / 30 + 1 past the chunk start
+	u64 p_max = job->primes.empty( ) ? 0 : job->primes.back( );
+	u64 ahead = 2 + ( p_max * 7 / 30 + 6 ) / seg_bytes;
+	job->ring = 1;
+	while ( job->ring < ahead + 1 )
+	{
+		job->ring <<= 1;
+	};
+};
+
+// chunk size for about target chunks, but long enough that starting the sieving primes ( a divide each ) stays a small part
+static void plan_chunks( sieve_job* job, u64 target )
+{
+	u64 segments = ( job->total_bytes + seg_bytes - 1 ) / seg_bytes;
+	u64 per_chunk = ( segments + target - 1 ) / target;
+	u64 min_chunk = 1 + job->primes.size( ) / 4096;
+	per_chunk = ( per_chunk < min_chunk ) ? min_chunk : per_chunk;
+	job->chunk_bytes = per_chunk * seg_bytes;
+	job->chunks = ( job->total_bytes + job->chunk_bytes - 1 ) / job->chunk_bytes;
+};
+
+// sieve the todo chunks on up to threads threads ( the calling thread is worker zero ); sum of the chunks to sum
+// returns: count of primes in the chunks; steals to *steals; threads used to job->threads
+static u64 run_job( sieve_job* job, int threads, u64* sum, u64* steals )
+{
+	zero_u( sum );
+	*steals = 0;
+	u64 todo = job->todo.size( );
+	threads = ( u64( threads ) > todo ) ? int( todo ) : threads;
+	job->threads = threads;
+	if ( threads == 0 )
+	{
+		return 0;
+	};
+
+	job->work = new work_range [ threads ];
+	for ( int i = 0; i < threads; i++ )
+	{
+		job->work [ i ].range.store( pack_range( todo * i / threads, todo * ( i + 1 ) / threads ), std::memory_order_relaxed );
+		job->work [ i ].steals = 0;
+		job->work [ i ].primes = 0;
+	};
+	acc_init( &job->acc, threads );
+
+	std::vector<std::thread> pool;
+	for ( int i = 1; i < threads; i++ )
+	{
+		pool.emplace_back( sieve_worker_run, job, i );
+	};
+	sieve_worker_run( job, 0 );
+	for ( std::thread& th : pool )
+	{
+		th.join( );
+	};
+
+	_UI512( overflow ) { 0 };
+	acc_read( &job->acc, sum, overflow );
+	u64 primes = 0;
+	for ( int i = 0; i < threads; i++ )
+	{
+		primes += job->work [ i ].primes;
+		*steals += job->work [ i ].steals;
+	};
+	acc_release( &job->acc );
+	delete [ ] job->work;
+
+	return primes;
+};
+
+// the primes the wheel and the pattern leave out
+// returns: count of them added to sum
+static u64 add_wheel_primes( u64* sum, u64 limit )
+{
+	static const u32 wheel_primes [ 6 ] = { 2, 3, 5, 7, 11, 13 };
+	u64 primes = 0;
+	for ( int i = 0; i < 6; i++ )
+	{
+		if ( wheel_primes [ i ] <= limit )
+		{
+			add_uT64( sum, sum, wheel_primes [ i ] );
+			primes++;
+		};
+	};
+	return primes;
+};
+
+static void fill_stats( primesum_stats* stats, u64 primes, u64 counted, u64 chunks, u64 steals, int threads, std::chrono::steady_clock::time_point t_start )
+{
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now( ) - t_start;
+	stats->primes = primes;
+	stats->chunks = chunks;
+	stats->steals = steals;
+	stats->threads = threads;
+	stats->seconds = elapsed.count( );
+	stats->primes_per_second = ( stats->seconds > 0.0 ) ? double( counted ) / stats->seconds : 0.0;
+	stats->resumed = 0;
+	stats->checkpoints = 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Lucy_Hedgehog: S( v ) = sum of the numbers 2 to v that survive sieving by the primes below p, kept only for the values v = n / k
+// ( at most 2 sqrt( n ) of them: each v to sqrt( n ), and n / k for each k to sqrt( n ) ). Start from S( v ) = v ( v + 1 ) / 2 - 1;
+// then for each prime p to sqrt( n ), and each kept v >= p * p, largest v first ( so S( v / p ) is still the previous round's ):
+//		S( v ) -= p * ( S( v / p ) - S( p - 1 ) )
+// removes the sum of the survivors whose least prime factor is p. S( p - 1 ) is then the sum of the primes below p, and S( n ) the answer.
+// Sums reach n^2 / 2 ( 2^95 at the limit ), so each is a ui512; the count C( v ) follows the same steps in a qword ( factor 1, not p ).
+
+// a 512 bit sum in an array, aligned as the kernels want it
+struct alignas( 64 ) lucy_value
+{
+	u64 v [ 8 ];
+};
+
+// S( v ) -= p * ( S( w ) - sp ); C( v ) -= C( w ) - cp
+static inline void lucy_step( lucy_value* s, u64* c, const lucy_value* sw, u64 cw, const u64* sp, u64 cp, u64 p )
+{
+	_UI512( t ) { 0 };
+	u64 overflow = 0;
+	sub_u( t, sw->v, sp );
+	mult_uT64( t, &overflow, t, p );
+	sub_u( s->v, s->v, t );
+	*c -= cw - cp;
+};
+
+// returns: count of primes to n; sum of them to sum
+static u64 lucy_sum( u64* sum, u64 n )
+{
+	zero_u( sum );
+	if ( n < 2 )
+	{
+		return 0;
+	};
+
+	// small [ v ] for v to r; large [ k ] for v = n / k, k to r
+	const u64 r = root_of( n );
+	std::vector<lucy_value> small( size_t( r + 1 ) );
+	std::vector<lucy_value> large( size_t( r + 1 ) );
+	std::vector<u64> small_c( size_t( r + 1 ) );
+	std::vector<u64> large_c( size_t( r + 1 ) );
+
+	auto initial = [ ] ( lucy_value* s, u64* c, u64 v )
+		{
+			// v ( v + 1 ) / 2 - 1, with v ( v + 1 ) under 2^97
+			u64 overflow = 0;
+			set_uT64( s->v, v );
+			mult_uT64( s->v, &overflow, s->v, v + 1 );
+			shr_u( s->v, s->v, 1 );
+			sub_uT64( s->v, s->v, 1ull );
+			*c = v - 1;
+		};
+	for ( u64 v = 1; v <= r; v++ )
+	{
+		initial( &small [ size_t( v ) ], &small_c [ size_t( v ) ], v );
+		initial( &large [ size_t( v ) ], &large_c [ size_t( v ) ], n / v );
+	};
+
+	for ( u64 p = 2; p <= r; p++ )
+	{
+		if ( small_c [ size_t( p ) ] == small_c [ size_t( p - 1 ) ] )
+		{
+			continue;		// p was struck out: not prime
+		};
+		const u64* sp = small [ size_t( p - 1 ) ].v;
+		const u64 cp = small_c [ size_t( p - 1 ) ];
+		const u64 p2 = p * p;
+
+		// large values, n / k >= p * p; n / k / p is n / ( k p ), held in large while k p <= r
+		u64 k_max = n / p2;
+		k_max = ( k_max < r ) ? k_max : r;
+		for ( u64 k = 1; k <= k_max; k++ )
+		{
+			u64 kp = k * p;
+			if ( kp <= r )
+			{
+				lucy_step( &large [ size_t( k ) ], &large_c [ size_t( k ) ], &large [ size_t( kp ) ], large_c [ size_t( kp ) ], sp, cp, p );
+			}
+			else
+			{
+				u64 w = n / kp;
+				lucy_step( &large [ size_t( k ) ], &large_c [ size_t( k ) ], &small [ size_t( w ) ], small_c [ size_t( w ) ], sp, cp, p );
+			};
+		};
+
+		// small values, largest first
+		for ( u64 v = r; v >= p2; v-- )
+		{
+			u64 w = v / p;
+			lucy_step( &small [ size_t( v ) ], &small_c [ size_t( v ) ], &small [ size_t( w ) ], small_c [ size_t( w ) ], sp, cp, p );
+		};
+	};
+
+	copy_u( sum, large [ 1 ].v );
+	return large_c [ 1 ];
+};
+
+s16 sum_primes_u( u64* sum, u64 limit, int threads, primesum_stats* stats, primesum_method method )
+{
+	if ( limit > primesum_limit_max || threads < 0 || ( method != primesum_sieve && method != primesum_lucy ) )
+	{
+		return -1;
+	};
+	auto t_start = std::chrono::steady_clock::now( );
+
+	if ( method == primesum_lucy )
+	{
+		u64 primes = lucy_sum( sum, limit );
+		if ( stats != nullptr )
+		{
+			fill_stats( stats, primes, primes, 0, 0, 1, t_start );
+		};
+		return 0;
+	};
+
+	if ( threads == 0 )
+	{
+		threads = int( std::thread::hardware_concurrency( ) );
+		threads = ( threads < 1 ) ? 1 : threads;
+	};
+
+	// about 16 chunks per thread, for balance
+	sieve_job job;
+	plan_primes( &job, limit );
+	plan_chunks( &job, u64( threads ) * 16 );
+	for ( u64 c = 0; c < job.chunks; c++ )
+	{
+		job.todo.push_back( u32( c ) );
+	};
+
+	u64 steals = 0;
+	u64 primes = run_job( &job, threads, sum, &steals );
+	primes += add_wheel_primes( sum, limit );
+
+	if ( stats != nullptr )
+	{
+		fill_stats( stats, primes, primes, job.chunks, steals, job.threads, t_start );
+	};
+
+	return 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Checkpoints: the workers publish finished chunks into job->results ( one buffer ); the I/O thread folds them into its record ( the other )
+// and writes that to the file slots in turn
+
+static const int record_qwords = int( sizeof( primesum_record ) / sizeof( u64 ) );
+static const int checksum_at = 7;			// qword index of checksum
+
+static u64 record_checksum( const primesum_record* rec )
+{
+	const u64* q = ( const u64* ) rec;
+	u64 crc = 0xFFFFFFFFull;
+	for ( int i = 0; i < record_qwords; i++ )
+	{
+		crc = _mm_crc32_u64( crc, ( i == checksum_at ) ? 0ull : q [ i ] );
+	};
+	return crc ^ 0xFFFFFFFFull;
+};
+
+static inline bool chunk_done( const primesum_record* rec, u64 chunk )
+{
+	return ( rec->done [ chunk / 64 ] >> ( chunk % 64 ) ) & 1;
+};
+
+static std::FILE* open_file( const char* path, const char* mode )
+{
+#if defined( _MSC_VER )
+	std::FILE* f = nullptr;
+	return ( fopen_s( &f, path, mode ) == 0 ) ? f : nullptr;
+#else
+	return std::fopen( path, mode );
+#endif
+};
+
+// the newer of the two slots that checks out, to rec
+// returns: true if one did
+static bool read_checkpoint( std::FILE* f, primesum_record* rec )
+{
+	primesum_record* slot = new primesum_record [ 2 ];
+	std::memset( slot, 0, 2 * sizeof( primesum_record ) );
+	size_t got = std::fread( slot, sizeof( primesum_record ), 2, f );
+	int best = -1;
+	for ( size_t i = 0; i < got; i++ )
+	{
+		const primesum_record* r = &slot [ i ];
+		bool valid = r->magic == primesum_checkpoint_magic && r->version == primesum_checkpoint_version
+			&& r->checksum == record_checksum( r ) && r->chunks <= u32( primesum_checkpoint_chunks )
+			&& r->chunk_bytes != 0 && r->chunk_bytes % seg_bytes == 0;
+		if ( valid && ( best < 0 || r->sequence > slot [ best ].sequence ) )
+		{
+			best = int( i );
+		};
+	};
+	if ( best >= 0 )
+	{
+		std::memcpy( rec, &slot [ best ], sizeof( primesum_record ) );
+	};
+	delete [ ] slot;
+	return best >= 0;
+};
+
+struct checkpoint_writer
+{
+	sieve_job* job;
+	primesum_record* rec;						// owned by the I/O thread while it runs
+	std::FILE* f;
+	double interval;
+	std::mutex lock;
+	std::condition_variable wake;
+	bool finished;								// set, under lock, once the workers are done
+	u64 written;
+};
+
+// fold newly published chunks into the record
+// returns: count folded
+static u64 fold_results( checkpoint_writer* w )
+{
+	u64 folded = 0;
+	for ( u64 c = 0; c < w->job->chunks; c++ )
+	{
+		const chunk_result* r = &w->job->results [ c ];
+		if ( !chunk_done( w->rec, c ) && r->done.load( std::memory_order_acquire ) != 0 )
+		{
+			_UI512( partial ) { 0 };
+			partial [ 6 ] = r->hi;
+			partial [ 7 ] = r->lo;
+			add_u( w->rec->sum, w->rec->sum, partial );
+			w->rec->primes += r->primes;
+			w->rec->done [ c / 64 ] |= 1ull << ( c % 64 );
+			w->rec->completed++;
+			folded++;
+		};
+	};
+	return folded;
+};
+
+static void write_checkpoint( checkpoint_writer* w )
+{
+	primesum_record* rec = w->rec;
+	rec->sequence++;
+	rec->checksum = record_checksum( rec );
+	long at = long( sizeof( primesum_record ) * ( rec->sequence & 1 ) );
+	if ( std::fseek( w->f, at, SEEK_SET ) == 0 && std::fwrite( rec, sizeof( primesum_record ), 1, w->f ) == 1 && std::fflush( w->f ) == 0 )
+	{
+		w->written++;
+	};
+};
+
+static void checkpoint_run( checkpoint_writer* w )
+{
+	auto interval = std::chrono::duration<double>( w->interval );
+	bool last = false;
+	while ( !last )
+	{
+		{
+			std::unique_lock<std::mutex> guard( w->lock );
+			w->wake.wait_for( guard, interval, [ w ] { return w->finished; } );
+			last = w->finished;
+		};
+		if ( fold_results( w ) != 0 )
+		{
+			write_checkpoint( w );
+		};
+	};
+};
+
+s16 sum_primes_resumable_u( u64* sum, u64 limit, const char* path, double interval, const std::atomic<bool>* stop, int threads, primesum_stats* stats )
+{
+	if ( limit > primesum_limit_max || threads < 0 || path == nullptr || !( interval > 0.0 ) )
+	{
+		return -1;
+	};
+	auto t_start = std::chrono::steady_clock::now( );
+
+	if ( threads == 0 )
+	{
+		threads = int( std::thread::hardware_concurrency( ) );
+		threads = ( threads < 1 ) ? 1 : threads;
+	};
+
+	sieve_job job;
+	plan_primes( &job, limit );
+
+	// resume from the file's record, or start one
+	primesum_record* rec = new primesum_record;
+	std::FILE* f = open_file( path, "r+b" );
+	bool resumed = ( f != nullptr ) && read_checkpoint( f, rec );
+	if ( resumed && ( rec->limit != limit || ( job.total_bytes + rec->chunk_bytes - 1 ) / rec->chunk_bytes != rec->chunks ) )
+	{
+		std::fclose( f );
+		delete rec;
+		return -1;
+	};
+	if ( f == nullptr )
+	{
+		f = open_file( path, "w+b" );
+		if ( f == nullptr )
+		{
+			delete rec;
+			return -1;
+		};
+	};
+	if ( resumed )
+	{
+		job.chunk_bytes = rec->chunk_bytes;
+		job.chunks = rec->chunks;
+	}
+	else
+	{
+		plan_chunks( &job, u64( primesum_checkpoint_chunks ) );
+		std::memset( rec, 0, sizeof( primesum_record ) );
+		rec->magic = primesum_checkpoint_magic;
+		rec->version = primesum_checkpoint_version;
+		rec->chunks = u32( job.chunks );
+		rec->limit = limit;
+		rec->chunk_bytes = job.chunk_bytes;
+	};
+	const u64 resumed_chunks = rec->completed;
+	const u64 resumed_primes = rec->primes;
+	for ( u64 c = 0; c < job.chunks; c++ )
+	{
+		if ( !chunk_done( rec, c ) )
+		{
+			job.todo.push_back( u32( c ) );
+		};
+	};
+
+	job.results = new chunk_result [ size_t( job.chunks ) ];
+	for ( u64 c = 0; c < job.chunks; c++ )
+	{
+		job.results [ c ].done.store( 0, std::memory_order_relaxed );
+	};
+	job.stop = stop;
+
+	checkpoint_writer* w = new checkpoint_writer;
+	w->job = &job;
+	w->rec = rec;
+	w->f = f;
+	w->interval = interval;
+	w->finished = false;
+	w->written = 0;
+	std::thread io( checkpoint_run, w );
+
+	u64 steals = 0;
+	_UI512( run_sum ) { 0 };
+	run_job( &job, threads, run_sum, &steals );
+
+	{
+		std::lock_guard<std::mutex> guard( w->lock );
+		w->finished = true;
+	};
+	w->wake.notify_one( );
+	io.join( );
+	std::fclose( f );
+
+	// the record now holds every finished chunk, from this run and before it
+	copy_u( sum, rec->sum );
+	u64 primes = rec->primes + add_wheel_primes( sum, limit );
+	s16 rc = ( rec->completed == job.chunks ) ? 0 : 1;
+
+	if ( stats != nullptr )
+	{
+		fill_stats( stats, primes, rec->primes - resumed_primes, job.chunks, steals, job.threads, t_start );
+		stats->resumed = resumed_chunks;
+		stats->checkpoints = w->written;
+	};
+	delete [ ] job.results;
+	delete w;
+	delete rec;
+
+	return rc;
+};
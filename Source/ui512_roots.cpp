@@ -0,0 +1,217 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_roots
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_roots.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Integer square and k-th roots, and perfect power detection, built on the ui512 kernels.
+//		Newton for the k-th root:	x' = ( ( k - 1 ) * x + value / x^( k - 1 ) ) / k, from any x at or above the root, until x' >= x.
+
+#include "ui512_roots.h"
+#include "ui512_externs.h"
+
+#include <cmath>
+#include <intrin.h>
+
+// the value as a double, and the shift: value ~ top * 2^shift, top the leading 53 bits
+static double leading_bits( const u64* value, int msb, int* shift )
+{
+	int s = ( msb > 52 ) ? msb - 52 : 0;
+	_UI512( t ) { 0 };
+	shr_u( t, value, u16( s ) );
+	*shift = s;
+	return double( t [ 7 ] );
+};
+
+// root = x, x a positive double ( at least one ), rounded up
+static void from_double( u64* root, double x )
+{
+	int e = 0;
+	double m = std::frexp( x, &e );					// x = m * 2^e, m in [ 0.5, 1 )
+	if ( e <= 63 )
+	{
+		set_uT64( root, u64( std::ceil( x ) ) );
+	}
+	else
+	{
+		set_uT64( root, u64( std::ldexp( m, 53 ) ) + 1 );
+		shl_u( root, root, u16( e - 53 ) );
+	};
+};
+
+// p = x^e ( e at least one ), false if it reaches 2^512; left to right square and multiply, each partial power no more than the whole
+static bool pow_capped( u64* p, const u64* x, u32 e )
+{
+	_UI512( t ) { 0 };
+	_UI512( hi ) { 0 };
+	unsigned long top = 0;
+	_BitScanReverse( &top, e );
+	copy_u( p, x );
+	for ( int b = int( top ) - 1; b >= 0; b-- )
+	{
+		mult_u( t, hi, p, p );
+		if ( compare_uT64( hi, 0ull ) != 0 )
+		{
+			return false;
+		};
+		if ( ( e >> b ) & 1 )
+		{
+			mult_u( p, hi, t, x );
+			if ( compare_uT64( hi, 0ull ) != 0 )
+			{
+				return false;
+			};
+		}
+		else
+		{
+			copy_u( p, t );
+		};
+	};
+	return true;
+};
+
+s16 isqrt_u( u64* root, const u64* value )
+{
+	s16 msb = msb_u( value );
+	if ( msb < 0 )
+	{
+		zero_u( root );
+		return 0;
+	};
+
+	// seed: sqrt( top + 1 ) * 2^( shift / 2 ), shift even, one over for the rounding of the square root
+	int shift = 0;
+	double top = leading_bits( value, msb, &shift );
+	if ( shift & 1 )
+	{
+		top = std::ldexp( top, 1 );
+		shift--;
+	};
+	_UI512( x ) { 0 };
+	_UI512( y ) { 0 };
+	_UI512( q ) { 0 };
+	_UI512( r ) { 0 };
+	from_double( x, std::sqrt( top + 1.0 ) + 1.0 );
+	shl_u( x, x, u16( shift / 2 ) );
+
+	// x' = ( x + value / x ) / 2; x below 2^257, value / x below 2^511, so no carry out
+	for ( ;; )
+	{
+		div_u( q, r, value, x );
+		add_u( y, x, q );
+		shr_u( y, y, 1 );
+		if ( compare_u( y, x ) >= 0 )
+		{
+			break;
+		};
+		copy_u( x, y );
+	};
+	copy_u( root, x );
+
+	return 0;
+};
+
+s16 iroot_u( u64* root, const u64* value, u32 k )
+{
+	if ( k == 0 )
+	{
+		return -1;
+	};
+	if ( k == 1 )
+	{
+		copy_u( root, value );
+		return 0;
+	};
+	if ( k == 2 )
+	{
+		return isqrt_u( root, value );
+	};
+	s16 msb = msb_u( value );
+	if ( msb < 0 || u32( msb ) < k )
+	{
+		set_uT64( root, ( msb < 0 ) ? 0ull : 1ull );		// under 2^k: root zero or one
+		return 0;
+	};
+
+	// seed: 2^( log2( value ) / k ), a little over ( the double carries log2 to about 2^-44 here )
+	int shift = 0;
+	double top = leading_bits( value, msb, &shift );
+	double l = ( std::log2( top + 1.0 ) + double( shift ) ) / double( k );
+	_UI512( x ) { 0 };
+	_UI512( y ) { 0 };
+	_UI512( p ) { 0 };
+	_UI512( q ) { 0 };
+	_UI512( r ) { 0 };
+	from_double( x, std::exp2( l ) * ( 1.0 + 0x1.0p-30 ) + 1.0 );
+
+	for ( ;; )
+	{
+		// q = value / x^( k - 1 ), zero if that power passes 512 bits; x root or more, so ( k - 1 ) * x fits
+		if ( pow_capped( p, x, k - 1 ) )
+		{
+			div_u( q, r, value, p );
+		}
+		else
+		{
+			zero_u( q );
+		};
+		u64 overflow = 0;
+		mult_uT64( y, &overflow, x, u64( k - 1 ) );
+		add_u( y, y, q );
+		u64 rem = 0;
+		div_uT64( y, &rem, y, u64( k ) );
+		if ( compare_u( y, x ) >= 0 )
+		{
+			break;
+		};
+		copy_u( x, y );
+	};
+	copy_u( root, x );
+
+	return 0;
+};
+
+s16 is_perfect_power_u( u64* root, u32* exponent, const u64* value )
+{
+	static const u16 primes [ ] = {
+		2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131,
+		137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271,
+		277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433,
+		439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509 };
+
+	_UI512( v ) { 0 };
+	_UI512( r ) { 0 };
+	_UI512( p ) { 0 };
+	copy_u( v, value );
+	u32 e = 1;
+
+	// a root of v is at least 2, so a prime exponent k needs v >= 2^k; after a hit, the same prime ( and larger ) is tried on the root
+	int i = 0;
+	while ( i < int( sizeof( primes ) / sizeof( primes [ 0 ] ) ) )
+	{
+		s16 msb = msb_u( v );
+		if ( msb < 1 || primes [ i ] > msb )
+		{
+			break;
+		};
+		iroot_u( r, v, primes [ i ] );
+		if ( pow_capped( p, r, primes [ i ] ) && compare_u( p, v ) == 0 )
+		{
+			copy_u( v, r );
+			e *= primes [ i ];
+		}
+		else
+		{
+			i++;
+		};
+	};
+	copy_u( root, v );
+	*exponent = e;
+
+	return ( e > 1 ) ? 1 : 0;
+};
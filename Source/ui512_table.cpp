@@ -0,0 +1,260 @@
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		ui512_table
+//
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+//		File:			ui512_table.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 ( file creation )
+//
+//		Memory mapped tables of 512 bit values. The mapping handle is closed as soon as the view is mapped ( the view keeps the mapping
+//		alive on both platforms ), so a table is its view: base and size. On Windows a writable table also keeps its file handle: flushing
+//		the view only starts the write back, FlushFileBuffers on the file waits for it, as msync( MS_SYNC ) does elsewhere.
+
+#include "ui512_table.h"
+
+#include <cstring>
+
+#if defined( _WIN32 )
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const u64 header_bytes = sizeof( ui512_table_header );
+static const u64 value_bytes = 64;
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Platform: map a file of bytes ( created at that size, or existing ), unmap, flush. One signature for both; each platform uses
+// what it needs ( Windows: the file handle; elsewhere: the size )
+
+#if defined( _WIN32 )
+
+// returns: the view, or nullptr; *bytes the file size ( in, when creating ); *handle the file, kept open if writable ( else nullptr )
+static void* map_file( const char* path, u64* bytes, bool create, bool writable, void** handle )
+{
+	*handle = nullptr;
+	DWORD access = writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+	HANDLE file = CreateFileA( path, access, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, create ? CREATE_ALWAYS : OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, nullptr );
+	if ( file == INVALID_HANDLE_VALUE )
+	{
+		return nullptr;
+	};
+	if ( !create )
+	{
+		LARGE_INTEGER size;
+		if ( !GetFileSizeEx( file, &size ) || size.QuadPart == 0 )
+		{
+			CloseHandle( file );
+			return nullptr;
+		};
+		*bytes = u64( size.QuadPart );
+	};
+
+	// creating: the mapping size extends the file ( zero filled )
+	HANDLE mapping = CreateFileMappingA( file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+		create ? DWORD( *bytes >> 32 ) : 0, create ? DWORD( *bytes ) : 0, nullptr );
+	void* view = nullptr;
+	if ( mapping != nullptr )
+	{
+		view = MapViewOfFile( mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0 );
+		CloseHandle( mapping );
+	};
+	if ( view != nullptr && writable )
+	{
+		*handle = file;
+	}
+	else
+	{
+		CloseHandle( file );
+	};
+	return view;
+};
+
+static void unmap_file( void* base, [[maybe_unused]] u64 bytes, void* handle )
+{
+	UnmapViewOfFile( base );
+	if ( handle != nullptr )
+	{
+		CloseHandle( handle );
+	};
+};
+
+// FlushViewOfFile queues the changed pages; FlushFileBuffers returns once they are written
+static bool flush_file( void* base, [[maybe_unused]] u64 bytes, void* handle )
+{
+	return FlushViewOfFile( base, 0 ) != 0 && FlushFileBuffers( handle ) != 0;
+};
+
+#else
+
+static void* map_file( const char* path, u64* bytes, bool create, bool writable, void** handle )
+{
+	*handle = nullptr;
+	int fd = create ? open( path, O_RDWR | O_CREAT | O_TRUNC, 0644 ) : open( path, writable ? O_RDWR : O_RDONLY );
+	if ( fd < 0 )
+	{
+		return nullptr;
+	};
+	struct stat st;
+	bool sized = create ? ftruncate( fd, off_t( *bytes ) ) == 0 : ( fstat( fd, &st ) == 0 && st.st_size > 0 );
+	if ( !sized )
+	{
+		close( fd );
+		return nullptr;
+	};
+	if ( !create )
+	{
+		*bytes = u64( st.st_size );
+	};
+
+	void* view = mmap( nullptr, size_t( *bytes ), writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0 );
+	close( fd );
+	return ( view == MAP_FAILED ) ? nullptr : view;
+};
+
+static void unmap_file( void* base, u64 bytes, [[maybe_unused]] void* handle )
+{
+	munmap( base, size_t( bytes ) );
+};
+
+static bool flush_file( void* base, u64 bytes, [[maybe_unused]] void* handle )
+{
+	return msync( base, size_t( bytes ), MS_SYNC ) == 0;
+};
+
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+static void set_view( ui512_table* table, void* base, u64 bytes, bool writable, void* handle )
+{
+	const ui512_table_header* h = ( const ui512_table_header* ) base;
+	table->base = base;
+	table->handle = handle;
+	table->bytes = bytes;
+	table->records = ( u64* ) ( ( u8* ) base + header_bytes );
+	table->count = h->count;
+	table->width = h->width;
+	table->tag = h->tag;
+	table->writable = writable;
+};
+
+// file size for count records of width values, or zero if it overflows
+static u64 table_bytes( u64 count, u32 width )
+{
+	u64 record = u64( width ) * value_bytes;
+	if ( width == 0 || count > ( ~0ull - header_bytes ) / record )
+	{
+		return 0;
+	};
+	return header_bytes + count * record;
+};
+
+s16 table_create( ui512_table* table, const char* path, u64 count, u32 width, u64 tag )
+{
+	u64 bytes = table_bytes( count, width );
+	if ( bytes == 0 )
+	{
+		return -1;
+	};
+	void* handle = nullptr;
+	void* base = map_file( path, &bytes, true, true, &handle );
+	if ( base == nullptr )
+	{
+		return -1;
+	};
+
+	ui512_table_header* h = ( ui512_table_header* ) base;
+	std::memset( h, 0, sizeof( ui512_table_header ) );
+	h->magic = ui512_table_magic;
+	h->version = ui512_table_version;
+	h->width = width;
+	h->count = count;
+	h->tag = tag;
+	set_view( table, base, bytes, true, handle );
+
+	return 0;
+};
+
+s16 table_open( ui512_table* table, const char* path, bool writable )
+{
+	u64 bytes = 0;
+	void* handle = nullptr;
+	void* base = map_file( path, &bytes, false, writable, &handle );
+	if ( base == nullptr )
+	{
+		return -1;
+	};
+
+	const ui512_table_header* h = ( const ui512_table_header* ) base;
+	if ( bytes < header_bytes || h->magic != ui512_table_magic || h->version != ui512_table_version
+		|| table_bytes( h->count, h->width ) != bytes )
+	{
+		unmap_file( base, bytes, handle );
+		return -1;
+	};
+	set_view( table, base, bytes, writable, handle );
+
+	return 0;
+};
+
+s16 table_advise( ui512_table* table, int advice )
+{
+	bool ok = true;
+#if defined( _WIN32 )
+	// no access pattern hints for mapped files, nor large pages; prefetch is the nearest to sequential
+	if ( advice & table_advice_sequential )
+	{
+		WIN32_MEMORY_RANGE_ENTRY range = { table->base, size_t( table->bytes ) };
+		ok = PrefetchVirtualMemory( GetCurrentProcess( ), 1, &range, 0 ) != 0;
+	};
+#else
+	if ( advice & table_advice_sequential )
+	{
+		ok = madvise( table->base, size_t( table->bytes ), MADV_SEQUENTIAL ) == 0 && ok;
+	};
+	if ( advice & table_advice_random )
+	{
+		ok = madvise( table->base, size_t( table->bytes ), MADV_RANDOM ) == 0 && ok;
+	};
+#if defined( MADV_HUGEPAGE )
+	// large pages for file mappings depend on the kernel and the file system: a refusal is the platform lacking it, not an error
+	if ( advice & table_advice_hugepage )
+	{
+		madvise( table->base, size_t( table->bytes ), MADV_HUGEPAGE );
+	};
+#endif
+#endif
+	return ok ? 0 : -1;
+};
+
+s16 table_sync( ui512_table* table )
+{
+	if ( !table->writable )
+	{
+		return 0;
+	};
+	return flush_file( table->base, table->bytes, table->handle ) ? 0 : -1;
+};
+
+void table_close( ui512_table* table )
+{
+	if ( table->base != nullptr )
+	{
+		unmap_file( table->base, table->bytes, table->handle );
+	};
+	table->base = nullptr;
+	table->handle = nullptr;
+	table->records = nullptr;
+	table->bytes = 0;
+	table->count = 0;
+};
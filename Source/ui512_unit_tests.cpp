@@ -33,14 +33,24 @@
 
 #include "CppUnitTest.h"
 #include "ui512_externs.h"
+#include "ui512_barrett.h"
+#include "ui512_format.h"
+#include "ui512_modular.h"
+#include "ui512_roots.h"
+#include "ui512_montgomery.h"
+#include "ui512_batch.h"
+#include "ui512_dispatch.h"
 #include "ui512_unit_tests.h"
 
+#include <cctype>
+#include <cstdlib>
 #include <cstring>
 #include <sstream>
 #include <format>
 #include <chrono>
 #include "intrin.h"
 #include <string>
+#include <utility>
 
 using namespace std;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -56,10 +66,46 @@ namespace ui512_Unit_Tests
 	const s32 timing_count_medium = 500000;
 	const s32 timing_count_long = 5000000;
 
-	const bool pipeline_test = false;
+	/// <summary>
+	/// Performance modes for this run ( see perf_mode ), from the environment variable UI512_PERF_MODE:
+	/// any of "latency", "throughput", "chain", "fixed", "all", in any case, separated by anything. Unset, or none of latency, throughput,
+	/// chain named: all three. In Visual Studio, set it in a .runsettings file ( RunConfiguration, EnvironmentVariables )
+	/// </summary>
+	/// <returns>perf_mode flags</returns>
+	int PerfModeFromEnvironment( )
+	{
+		string value;
+#if defined( _MSC_VER )
+		char* env = nullptr;
+		size_t env_len = 0;
+		if ( _dupenv_s( &env, &env_len, "UI512_PERF_MODE" ) == 0 && env != nullptr )
+		{
+			value = env;
+			free( env );
+		};
+#else
+		const char* env = getenv( "UI512_PERF_MODE" );
+		value = ( env != nullptr ) ? env : "";
+#endif
+		for ( char& c : value )
+		{
+			c = char( tolower( c ) );
+		};
+
+		const int measures = perf_mode_latency | perf_mode_throughput | perf_mode_chain;
+		int mode = ( value.find( "all" ) != string::npos ) ? measures | perf_mode_fixed : 0;
+		mode |= ( value.find( "latency" ) != string::npos ) ? perf_mode_latency : 0;
+		mode |= ( value.find( "throughput" ) != string::npos ) ? perf_mode_throughput : 0;
+		mode |= ( value.find( "chain" ) != string::npos ) ? perf_mode_chain : 0;
+		mode |= ( value.find( "fixed" ) != string::npos ) ? perf_mode_fixed : 0;
+		return ( ( mode & measures ) == 0 ) ? mode | measures : mode;
+	};
+
+	const int Perf_Mode = PerfModeFromEnvironment( );
+	const bool pipeline_test = ( Perf_Mode & perf_mode_fixed ) != 0;
 
 
-	//enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb };
+	//enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb, MontMul, MontSqr, BarrettMod, BarrettMod1024, Div64Pre, Mod64, ToDecimal, FromDecimal, ToHex, FromHex, Sqr, MulLo, MulHi, MulAdx, Mul64Adx, PowModWindow, PowModLadder, ModInv, ModInvVar, GcdBinary, GcdLehmer, GcdEuclid, Isqrt, IsqrtBits, Iroot3, PerfectPower, BatchAdd, AddX8, BatchMul, MulX8, BatchTranspose, MulX4, Mul4Calls, Div64X4, Div64_4Calls };
 	const string TestName [ ] = { "Compare: 512 <=> 512", "Compare 512 <=> 64",
 		"Add: 512 + 512", "Add: 512 + 512 + carry", "Add: 512 + 64",
 		"Subtract: 512 - 512", "Subtract: 512 - 512 - borrow", "Subtract: 512 - 64",
@@ -67,7 +113,22 @@ namespace ui512_Unit_Tests
 		"Divide: 512 / 512", "Divide: 512 / 64",
 		"Logical bit AND", "Logical bit OR", "Logical bit XOR", "Logical bit NOT",
 		"Shift Left", "Shift Right",
-		"Most significant bit", "Least significant bit"
+		"Most significant bit", "Least significant bit",
+		"Montgomery multiply: 512 * 512 mod N", "Montgomery square: 512 ^ 2 mod N",
+		"Barrett reduction: 512 mod fixed 512", "Barrett reduction: 1024 mod fixed 512",
+		"Divide by fixed 64, precomputed reciprocal: 512 / 64", "Modulo fixed 64, precomputed reciprocal: 512 % 64",
+		"Decimal output: 512 to text", "Decimal input: text to 512",
+		"Hex output: 512 to text", "Hex input: text to 512",
+		"Square: 512 ^ 2", "Multiply, low half: 512 * 512", "Multiply, high half: 512 * 512",
+		"Multiply, MULX/ADX: 512 * 512", "Multiply, MULX/ADX: 512 * 64",
+		"Modular exponentiation, sliding window: 512 ^ 512 mod N", "Modular exponentiation, Montgomery ladder: 512 ^ 512 mod N",
+		"Modular inverse, constant time: 512 mod N", "Modular inverse, variable time: 512 mod N",
+		"GCD, binary: 512, 512", "GCD, Lehmer: 512, 512", "GCD, Euclid by div_u: 512, 512",
+		"Integer square root, Newton: 512", "Integer square root, a bit at a time: 512", "Integer cube root: 512", "Perfect power: 512",
+		"Batch add: 8 x ( 512 + 512 )", "Add, eight calls: 8 x ( 512 + 512 )", "Batch multiply: 8 x ( 512 * 512 )", "Multiply, eight calls: 8 x ( 512 * 512 )",
+		"Batch transpose: 8 x 512 in and out",
+		"Multiply, two interleaved pairs: 4 x ( 512 * 512 )", "Multiply, four calls: 4 x ( 512 * 512 )",
+		"Divide, interleaved: 4 x ( 512 / 64 )", "Divide, four calls: 4 x ( 512 / 64 )"
 	};
 
 	/// <summary>
@@ -106,6 +167,34 @@ namespace ui512_Unit_Tests
 		};
 	};
 
+	/// <summary>
+	/// Integer square root, a bit at a time ( the way it was done before isqrt_u ): 256 steps of compare, subtract, shift.
+	/// The oracle for isqrt_u, and its timing baseline
+	/// </summary>
+	/// <param name="root">floor( sqrt( value ) )</param>
+	/// <param name="value">512 bit value</param>
+	/// <returns>none</returns>
+	extern void IsqrtBitwise( u64* root, const u64* value )
+	{
+		_UI512( rem ) { 0 };
+		_UI512( bit ) { 0 };
+		_UI512( trial ) { 0 };
+		copy_u( rem, value );
+		zero_u( root );
+		bit [ 0 ] = 0x4000000000000000ull;						// highest power of four
+		for ( int i = 0; i < 256; i++ )
+		{
+			add_u( trial, root, bit );
+			shr_u( root, root, 1 );
+			if ( compare_u( rem, trial ) >= 0 )
+			{
+				sub_u( rem, rem, trial );
+				or_u( root, root, bit );
+			};
+			shr_u( bit, bit, 2 );
+		};
+	};
+
 	/// <summary>
 	/// 
 	/// </summary>
@@ -121,6 +210,48 @@ namespace ui512_Unit_Tests
 
 	u64 seed = 0;
 
+	/// <summary>
+	/// Timestamps that bracket the kernel: rdtsc alone does not wait, so the core can start it before the call ahead of it is done, or
+	/// run the call past it. Start: lfence ( earlier work done ), rdtsc, lfence ( the kernel not begun until the timestamp is taken ).
+	/// Stop: rdtscp ( waits for the kernel ), lfence ( nothing after it starts early )
+	/// </summary>
+	/// <returns>time stamp counter</returns>
+	inline u64 TimerStart( )
+	{
+		_mm_lfence( );
+		u64 start = __rdtsc( );
+		_mm_lfence( );
+		return start;
+	};
+
+	inline u64 TimerStop( )
+	{
+		unsigned int aux = 0;
+		u64 stop = __rdtscp( &aux );
+		_mm_lfence( );
+		return stop;
+	};
+
+	/// <summary>
+	/// Timer overhead: clock cycles of an empty measurement, TimerStart then TimerStop with nothing between. Measured once, at start up;
+	/// the least of the samples, the overhead with nothing in its way ( a larger figure would credit the kernels with noise )
+	/// </summary>
+	/// <returns>clock cycles</returns>
+	double TimerOverheadCalibrate( )
+	{
+		const int samples = 10000;
+		u64 least = ~0ull;
+		for ( int i = 0; i < 2 * samples; i++ )
+		{
+			u64 start = TimerStart( );
+			u64 duration = TimerStop( ) - start;
+			least = ( i >= samples && duration < least ) ? duration : least;	// first half: warm up
+		};
+		return double( least );
+	};
+
+	const double Timer_Overhead = TimerOverheadCalibrate( );
+
 	/// <summary>
 	/// 
 	/// </summary>
@@ -135,9 +266,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			RandomFill( num2, &seed );
 		};
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		rc = compare_u( num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -154,9 +285,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			num2 = RandomU64( &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		rc = compare_uT64( num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -175,9 +306,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			RandomFill( num2, &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		carry = add_u( sum, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -195,9 +326,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			RandomFill( num2, &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		carry = add_u_wc( sum, num1, num2, carry );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -215,9 +346,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			num2 = RandomU64( &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		carry = add_uT64( sum, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -233,9 +364,9 @@ namespace ui512_Unit_Tests
 		s16 borrow = 0;
 		RandomFill( num1, &seed );
 		RandomFill( num2, &seed );
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		borrow = sub_u( diff, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -251,9 +382,9 @@ namespace ui512_Unit_Tests
 		s16 borrow = 0;
 		RandomFill( num1, &seed );
 		RandomFill( num2, &seed );
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		borrow = sub_u_wb( diff, num1, num2, 0 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -269,9 +400,9 @@ namespace ui512_Unit_Tests
 		s16 borrow = 0;
 		RandomFill( num1, &seed );
 		num2 = RandomU64( &seed );
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		borrow = sub_uT64( diff, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -289,9 +420,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			RandomFill( num2, &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		s16 rc = mult_u( product, overflow, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -309,9 +440,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			num2 = RandomU64( &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		s16 rc = mult_uT64( product, &overflow, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -333,9 +464,9 @@ namespace ui512_Unit_Tests
 			num2 [ 0 ] = 0;
 			num2 [ 1 ] = 0;
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		s16 rc = div_u( quotient, remainder, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -353,9 +484,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			num2 = RandomU64( &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		s16 rc = div_uT64( quotient, &remainder, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -372,9 +503,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			RandomFill( num2, &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		and_u( result, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -391,9 +522,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			RandomFill( num2, &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		or_u( result, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -410,9 +541,9 @@ namespace ui512_Unit_Tests
 			RandomFill( num1, &seed );
 			RandomFill( num2, &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		xor_u( result, num1, num2 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -427,9 +558,9 @@ namespace ui512_Unit_Tests
 		{
 			RandomFill( num1, &seed );
 		}
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		not_u( result, num1 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -440,9 +571,9 @@ namespace ui512_Unit_Tests
 	{
 		_UI512( num1 ) { 0, 1, 2, 3, 4, 5, 6, 7 };
 		_UI512( result ) { 0 };
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		shl_u( result, num1, 180 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 
@@ -454,9 +585,9 @@ namespace ui512_Unit_Tests
 	{
 		_UI512( num1 ) { 0, 1, 2, 3, 4, 5, 6, 7 };
 		_UI512( result ) { 0 };
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		shr_u( result, num1, 180 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -467,9 +598,9 @@ namespace ui512_Unit_Tests
 	{
 		_UI512( num1 ) { 0, 1, 2, 3, 4, 5, 6, 7 };
 		s16 result = 0;
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		result = msb_u( num1 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
@@ -480,167 +611,1436 @@ namespace ui512_Unit_Tests
 	{
 		_UI512( num1 ) { 7, 6, 5, 4, 3, 2, 1, 0 };
 		s16 result = 0;
-		u64 start = __rdtsc( );
+		u64 start = TimerStart( );
 		result = lsb_u( num1 );
-		return ( __rdtsc( ) - start );
+		return ( TimerStop( ) - start );
 	};
 
 	/// <summary>
-	/// 
+	/// Montgomery context shared by the Montgomery timing tests: a random, odd, full 512 bit modulus, set up on first use
 	/// </summary>
-	/// <param name="stat"></param>
-	/// <param name="test_sel"></param>
-	void RunStats( perf_stats* stat, Perf_Tests test_sel )
+	/// <returns>context</returns>
+	const mont_ctx* DurationTest_MontCtx( )
 	{
-		double duration = 0;
-		stat->x_i = new std::vector<double>( stat->timing_count );
-		stat->z_score = new std::vector<double>( stat->timing_count );
-		stat->outliers = new std::vector<outlier>( 0 );
-		// for reference: enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb };
-		typedef u64( *targettest )( );
-		targettest targets [ ] = {
-			&DurationTest_Comp, &DurationTest_Comp64,
-			&DurationTest_Add, &DurationTest_AddwC, &DurationTest_Add64,
-			&DurationTest_Sub, &DurationTest_Subwb, &DurationTest_Sub64,
-			&DurationTest_Mul, &DurationTest_Mul64,
-			&DurationTest_Div, &DurationTest_Div64,
-			&DurationTest_And, &DurationTest_Or,
-			&DurationTest_Xor, &DurationTest_Not,
-			&DurationTest_Shl, &DurationTest_Shr,
-			&DurationTest_msb, &DurationTest_lsb
+		static mont_ctx ctx;
+		static bool initialized = false;
+		if ( !initialized )
+		{
+			_UI512( modulus ) { 0 };
+			u64 mseed = 0;
+			RandomFill( modulus, &mseed );
+			modulus [ 0 ] |= 0x8000000000000000ull;
+			modulus [ 7 ] |= 1ull;
+			mont_init( &ctx, modulus );
+			initialized = true;
 		};
+		return &ctx;
+	};
 
-		for ( int i = 0; i < warm_up_count; i++ ) {
-			duration = ( double ) targets [ test_sel ]( );
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_MontMul( )
+	{
+		const mont_ctx* ctx = DurationTest_MontCtx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			num1 [ 0 ] &= 0x7FFFFFFFFFFFFFFFull;	// less than the modulus
+			RandomFill( num2, &seed );
+			num2 [ 0 ] &= 0x7FFFFFFFFFFFFFFFull;
 		}
-		// Run target function timing_count times, capturing each duration, also getting min, max, and total duration spent
+		u64 start = TimerStart( );
+		mont_mul( result, num1, num2, ctx );
+		return ( TimerStop( ) - start );
+	};
 
-		for ( int i = 0; i < stat->timing_count; i++ )
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_MontSqr( )
+	{
+		const mont_ctx* ctx = DurationTest_MontCtx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
 		{
-			duration = ( double ) targets [ test_sel ]( );
-			stat->min = ( duration < stat->min ) ? duration : stat->min;
-			stat->max = ( duration > stat->max ) ? duration : stat->max;
-			stat->total += duration;
-			stat->x_i->at( i ) = duration;
-		};
+			RandomFill( num1, &seed );
+			num1 [ 0 ] &= 0x7FFFFFFFFFFFFFFFull;	// less than the modulus
+		}
+		u64 start = TimerStart( );
+		mont_sqr( result, num1, ctx );
+		return ( TimerStop( ) - start );
+	};
 
-		// Calculate mean, population variance, standard deviation, coefficient of variation, and z-scores
+	/// <summary>
+	/// Barrett context shared by the Barrett timing tests: a random, fixed, 384 bit divisor ( the Div test divisor shape ), set up on first use
+	/// </summary>
+	/// <returns>context</returns>
+	const barrett_ctx* DurationTest_BarrettCtx( )
+	{
+		static barrett_ctx ctx;
+		static bool initialized = false;
+		if ( !initialized )
 		{
-			stat->mean = stat->total / double( stat->timing_count );
-			for ( int i = 0; i < stat->timing_count; i++ )
-			{
-				double deviation = stat->x_i->at( i ) - stat->mean;
-				stat->sample_variance += deviation * deviation;
-			};
-
-			stat->sample_variance /= ( double( stat->timing_count ) - 1.0 );
-			stat->stddev = sqrt( stat->sample_variance );
-			stat->coefficient_of_variation = ( stat->mean != 0.0 ) ? ( stat->stddev / stat->mean ) * 100.0 : 0.0;
-			for ( int i = 0; i < stat->timing_count; i++ )
-			{
-				stat->z_score->at( i ) = ( stat->stddev != 0.0 ) ? ( stat->x_i->at( i ) - stat->mean ) / stat->stddev : 0.0;
-			};
-
-			string test_message = "***\t\t\t" + TestName [ test_sel ] + "\t\t\t***\n";
-			test_message += format( "Samples run:\t\t\t\t{:9d}\n", stat->timing_count );
-			test_message += format( "Total target function (including c calling set - up) execution cycles :{:10.0f}\n", stat->total );
-			test_message += format( "Average clock cycles per call: \t{:6.2f}\n", stat->mean );
-			test_message += format( "Minimum in \t\t\t\t\t\t{:6.0f}\n", stat->min );
-			test_message += format( "Maximum in \t\t\t\t\t\t{:6.0f}\n", stat->max );
-			test_message += format( "Sample Variance: \t\t\t{:10.3f}\n", stat->sample_variance );
-			test_message += format( "Standard Deviation :\t \t{:9.3f}\n", stat->stddev );
-			test_message += format( "Coefficient of Variation: \t{:10.2f}\n\n", stat->coefficient_of_variation );
-
-			Logger::WriteMessage( test_message.c_str( ) );
+			_UI512( divisor ) { 0 };
+			u64 dseed = 0;
+			RandomFill( divisor, &dseed );
+			divisor [ 0 ] = 0;
+			divisor [ 1 ] = 0;
+			divisor [ 2 ] |= 0x8000000000000000ull;
+			barrett_init( &ctx, divisor );
+			initialized = true;
 		};
+		return &ctx;
+	};
 
-		// Identify outliers, based on outlier_threshold
-		stat->outlier_threshold = 3.0 * stat->stddev;
-		for ( int i = 0; i < stat->timing_count; i++ )
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_BarrettMod( )
+	{
+		const barrett_ctx* ctx = DurationTest_BarrettCtx( );
+		_UI512( num1 ) { 10000, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( remainder ) { 0 };
+		if ( !pipeline_test )
 		{
-			double z_sc = stat->z_score->at( i );
-			double abs_z_score = ( z_sc < 0.0 ) ? -z_sc : z_sc;
-
-			if ( abs_z_score > 3.0 )
-			{
-				outlier o;
-				o.iteration = i;
-				o.duration = stat->x_i->at( i );
-				o.z_score = z_sc;
-				stat->outliers->push_back( o );
-			};
-		};
-
-		// Report on outliers, if any
-		// Note: in a normal distribution, 99.7% of all values will be within three standard deviations of the mean
-		// Thus, any value outside that range is an outlier
-		// In this test, we are looking for unexpected occurrences of outliers, which may indicate some kind of
-		// external interference in the timing test (such as OS activity, etc)
-		// If the number of outliers is small (say under 1% of total), then it is likely not a problem
-		// If the number of outliers is larger (say over 5% of total), then there may be a problem with the test environment
-		// We're determining 'average' (mean) performance as measured in clock cycles.
-		// The relaibility of the user achieving that average is higher if the deviation from mean is low,
-		// and the number of exceptional deviations (outliers) is low.
-
-		// Note: some functions may have a bi-modal distribution, in which case you must temper the results of the outlier test.
-		// for example, mult_u has a propagating carry loop, which may cause a bi-modal distribution, or at least a widening of the distribution
-		// Further, the CPU clock penalty of starting AVX instructions on some processors may cause outliers
-		//
-		double outlier_percentage = ( double ) ( stat->outliers->size( ) * 100.0 ) / ( double ) stat->timing_count;
-		double range_low = stat->mean - ( 3.0 * stat->stddev );
-		range_low = ( range_low < 0.0 ) ? 0.0 : range_low;
-		double range_high = stat->mean + ( 3.0 * stat->stddev );
+			RandomFill( num1, &seed );
+			num1 [ 0 ] = 0;
+			num1 [ 1 ] &= 0x000FFFFFFFFFull;
+		}
+		u64 start = TimerStart( );
+		barrett_mod( remainder, num1, ctx );
+		return ( TimerStop( ) - start );
+	};
 
-		if ( stat->outliers->size( ) > 0 )
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_BarrettMod1024( )
+	{
+		const barrett_ctx* ctx = DurationTest_BarrettCtx( );
+		_UI512( product ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( overflow ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( remainder ) { 0 };
+		if ( !pipeline_test )
 		{
-			string test_message = _MSGA( "Identified " << stat->outliers->size( ) << " outlier(s), based on a threshold of "
-				<< stat->outlier_threshold << " which is three standard deviations from the mean of " << stat->mean << " clock cycles.\n" );
-			test_message += _MSGA( "Samples with cycles from " << range_low << " to " << range_high << ", are within that range.\n" );
-			test_message += format( "Samples within this range are considered normal and contain {:6.3f}% of the samples.\n", ( 100.0 - outlier_percentage ) );
-			test_message += "Samples outside this range are considered outliers. ";
-			test_message += format( "This represents {:4.3f}% of the samples.", outlier_percentage );
-			test_message += "\nTested via Assert that the percentage of outliers is below 2%\n";
-			test_message += "\nUp to the first 20 are shown. z_score is the number of standards of deviation the outlier varies from the mean.\n\n";
-			test_message += " Iteration | Clock Cycles  |      Z Score  |\n";
-			test_message += "-----------|---------------|---------------|\n";
-
-			s32 outlier_limit = 20;
-			s32 count = 0;
-
-			for ( int i = 0; i < stat->outliers->size( ) && i < outlier_limit; i++ ) {
-				outlier o = stat->outliers->at( i );
-				test_message += format( "{:10d} |", o.iteration );
-				test_message += format( "{:13.0f}  |", o.duration );
-				test_message += format( "{:13.3f}  |", o.z_score );
-				test_message += "\n";
-			};
-			test_message += "\n";
+			RandomFill( product, &seed );
+			RandomFill( overflow, &seed );
+		}
+		u64 start = TimerStart( );
+		barrett_mod_1024( remainder, product, overflow, ctx );
+		return ( TimerStop( ) - start );
+	};
 
-			Assert::IsTrue( outlier_percentage < 2.0, L"Too many outliers, over 2% of total sample" );
-			Logger::WriteMessage( test_message.c_str( ) );
+	/// <summary>
+	/// 64 bit divisor context shared by the precomputed reciprocal timing tests: a random, fixed, 64 bit divisor, set up on first use
+	/// </summary>
+	/// <returns>context</returns>
+	const div64_ctx* DurationTest_Div64Ctx( )
+	{
+		static div64_ctx ctx;
+		static bool initialized = false;
+		if ( !initialized )
+		{
+			u64 dseed = 0;
+			div64_init( &ctx, RandomU64( &dseed ) | 1ull );
+			initialized = true;
 		};
-
-		// End of batch
-		stat->x_i->clear( );
-		delete stat->x_i;
-		stat->z_score->clear( );
-		delete stat->z_score;
-		stat->outliers->clear( );
-		delete stat->outliers;
-		return;
+		return &ctx;
 	};
 
-	TEST_CLASS( ui512_unit_tests )
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Div64Pre( )
 	{
-		TEST_METHOD( random_number_generator )
+		const div64_ctx* ctx = DurationTest_Div64Ctx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( quotient ) { 0 };
+		u64 remainder = 0;
+		if ( !pipeline_test )
 		{
-			//	Check distribution of "random" numbers
-			u64 seed = 0;
-			const u32 dec = 10;
-			u32 dist [ dec ] { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = div_uT64_pre( quotient, &remainder, num1, ctx );
+		return ( TimerStop( ) - start );
+	};
 
-			const u64 split = primeLT64 / dec;
-			u32 distc = 0;
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Mod64( )
+	{
+		const div64_ctx* ctx = DurationTest_Div64Ctx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		u64 remainder = 0;
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		remainder = mod_uT64( num1, ctx );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_ToDecimal( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		char buffer [ ui512_decimal_max + 1 ];
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 len = to_decimal( buffer, int( sizeof( buffer ) ), num1 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_FromDecimal( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		char buffer [ ui512_decimal_max + 1 ];
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		s16 len = to_decimal( buffer, int( sizeof( buffer ) ), num1 );
+		u64 start = TimerStart( );
+		s16 rc = from_decimal( num1, buffer, len );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_ToHex( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		char buffer [ ui512_hex_chars + 1 ];
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		to_hex( buffer, num1 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_FromHex( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		char buffer [ ui512_hex_chars + 1 ];
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		to_hex( buffer, num1 );
+		u64 start = TimerStart( );
+		s16 rc = from_hex( num1, buffer, ui512_hex_chars );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Sqr( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( product ) { 0 };
+		_UI512( overflow ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = sqr_u( product, overflow, num1 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_MulLo( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( product ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = mult_u_lo( product, num1, num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_MulHi( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( overflow ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = mult_u_hi( overflow, num1, num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_MulAdx( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( product ) { 0 };
+		_UI512( overflow ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = mult_u_adx( product, overflow, num1, num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Mul64Adx( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( product ) { 0 };
+		u64 num2 = 2;
+		u64 overflow = 0;
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			num2 = RandomU64( &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = mult_uT64_adx( product, &overflow, num1, num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// Modular exponentiation timing, with the shared Montgomery context ( its set up is not timed )
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_PowModWindow( )
+	{
+		const mont_ctx* ctx = DurationTest_MontCtx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = mont_pow( result, num1, num2, ctx, powmod_window );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_PowModLadder( )
+	{
+		const mont_ctx* ctx = DurationTest_MontCtx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = mont_pow( result, num1, num2, ctx, powmod_ladder );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// Modular inverse timing, odd modulus from the shared Montgomery context
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_ModInv( )
+	{
+		const mont_ctx* ctx = DurationTest_MontCtx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = modinv_u( result, num1, ctx->modulus );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_ModInvVar( )
+	{
+		const mont_ctx* ctx = DurationTest_MontCtx( );
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = modinv_u_var( result, num1, ctx->modulus );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_GcdBinary( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = gcd_u( result, num1, num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_GcdLehmer( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = gcd_u_lehmer( result, num1, num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// Naive Euclid, one div_u per step: the baseline for the gcd kernels
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_GcdEuclid( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( num2 ) { 8, 7, 6, 5, 4, 3, 2, 1 };
+		_UI512( quotient ) { 0 };
+		_UI512( remainder ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+		}
+		u64 start = TimerStart( );
+		while ( compare_uT64( num2, 0ull ) != 0 )
+		{
+			div_u( quotient, remainder, num1, num2 );
+			copy_u( num1, num2 );
+			copy_u( num2, remainder );
+		};
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Isqrt( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = isqrt_u( result, num1 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_IsqrtBits( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		IsqrtBitwise( result, num1 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Iroot3( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( result ) { 0 };
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = iroot_u( result, num1, 3 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_PerfectPower( )
+	{
+		_UI512( num1 ) { 1, 2, 3, 4, 5, 6, 7, 8 };
+		_UI512( result ) { 0 };
+		u32 exponent = 0;
+		if ( !pipeline_test )
+		{
+			RandomFill( num1, &seed );
+		}
+		u64 start = TimerStart( );
+		s16 rc = is_perfect_power_u( result, &exponent, num1 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_BatchAdd( )
+	{
+		ui512_batch num1 { };
+		ui512_batch num2 { };
+		ui512_batch sum { };
+		if ( !pipeline_test )
+		{
+			for ( int k = 0; k < 8; k++ )
+			{
+				RandomFill( num1.limb [ k ], &seed );
+				RandomFill( num2.limb [ k ], &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		u16 carry = batch_add( &sum, &num1, &num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// eight add_u calls, the work of one batch_add
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_AddX8( )
+	{
+		alignas ( 64 ) u64 num1 [ 8 ] [ 8 ] { };
+		alignas ( 64 ) u64 num2 [ 8 ] [ 8 ] { };
+		alignas ( 64 ) u64 sum [ 8 ] [ 8 ] { };
+		if ( !pipeline_test )
+		{
+			for ( int i = 0; i < 8; i++ )
+			{
+				RandomFill( num1 [ i ], &seed );
+				RandomFill( num2 [ i ], &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		for ( int i = 0; i < 8; i++ )
+		{
+			s16 rc = add_u( sum [ i ], num1 [ i ], num2 [ i ] );
+		};
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_BatchMul( )
+	{
+		ui512_batch num1 { };
+		ui512_batch num2 { };
+		ui512_batch product { };
+		ui512_batch overflow { };
+		if ( !pipeline_test )
+		{
+			for ( int k = 0; k < 8; k++ )
+			{
+				RandomFill( num1.limb [ k ], &seed );
+				RandomFill( num2.limb [ k ], &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		batch_mul( &product, &overflow, &num1, &num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// eight mult_u calls, the work of one batch_mul
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_MulX8( )
+	{
+		alignas ( 64 ) u64 num1 [ 8 ] [ 8 ] { };
+		alignas ( 64 ) u64 num2 [ 8 ] [ 8 ] { };
+		alignas ( 64 ) u64 product [ 8 ] [ 8 ] { };
+		alignas ( 64 ) u64 overflow [ 8 ] [ 8 ] { };
+		if ( !pipeline_test )
+		{
+			for ( int i = 0; i < 8; i++ )
+			{
+				RandomFill( num1 [ i ], &seed );
+				RandomFill( num2 [ i ], &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		for ( int i = 0; i < 8; i++ )
+		{
+			s16 rc = mult_u( product [ i ], overflow [ i ], num1 [ i ], num2 [ i ] );
+		};
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// batch_load then batch_store: the cost of moving eight numbers into and out of the batch layout
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_BatchTranspose( )
+	{
+		alignas ( 64 ) u64 numbers [ 8 ] [ 8 ] { };
+		ui512_batch batch { };
+		if ( !pipeline_test )
+		{
+			for ( int i = 0; i < 8; i++ )
+			{
+				RandomFill( numbers [ i ], &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		batch_load( &batch, numbers [ 0 ] );
+		batch_store( numbers [ 0 ], &batch );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_MulX4( )
+	{
+		alignas ( 64 ) u64 num1 [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 num2 [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 product [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 overflow [ 4 ] [ 8 ] { };
+		u64* products [ 4 ] = { product [ 0 ], product [ 1 ], product [ 2 ], product [ 3 ] };
+		u64* overflows [ 4 ] = { overflow [ 0 ], overflow [ 1 ], overflow [ 2 ], overflow [ 3 ] };
+		const u64* multiplicands [ 4 ] = { num1 [ 0 ], num1 [ 1 ], num1 [ 2 ], num1 [ 3 ] };
+		const u64* multipliers [ 4 ] = { num2 [ 0 ], num2 [ 1 ], num2 [ 2 ], num2 [ 3 ] };
+		if ( !pipeline_test )
+		{
+			for ( int i = 0; i < 4; i++ )
+			{
+				RandomFill( num1 [ i ], &seed );
+				RandomFill( num2 [ i ], &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		s16 rc = mult_u_x4( products, overflows, multiplicands, multipliers );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// four mult_u calls, back to back, the work of one mult_u_x4
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Mul4Calls( )
+	{
+		alignas ( 64 ) u64 num1 [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 num2 [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 product [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 overflow [ 4 ] [ 8 ] { };
+		if ( !pipeline_test )
+		{
+			for ( int i = 0; i < 4; i++ )
+			{
+				RandomFill( num1 [ i ], &seed );
+				RandomFill( num2 [ i ], &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		s16 rc = mult_u( product [ 0 ], overflow [ 0 ], num1 [ 0 ], num2 [ 0 ] );
+		rc = mult_u( product [ 1 ], overflow [ 1 ], num1 [ 1 ], num2 [ 1 ] );
+		rc = mult_u( product [ 2 ], overflow [ 2 ], num1 [ 2 ], num2 [ 2 ] );
+		rc = mult_u( product [ 3 ], overflow [ 3 ], num1 [ 3 ], num2 [ 3 ] );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Div64X4( )
+	{
+		alignas ( 64 ) u64 num1 [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 quotient [ 4 ] [ 8 ] { };
+		u64 num2 [ 4 ] = { 54760, 54761, 54762, 54763 };
+		u64 remainder [ 4 ] = { 0 };
+		u64* quotients [ 4 ] = { quotient [ 0 ], quotient [ 1 ], quotient [ 2 ], quotient [ 3 ] };
+		u64* remainders [ 4 ] = { &remainder [ 0 ], &remainder [ 1 ], &remainder [ 2 ], &remainder [ 3 ] };
+		const u64* dividends [ 4 ] = { num1 [ 0 ], num1 [ 1 ], num1 [ 2 ], num1 [ 3 ] };
+		if ( !pipeline_test )
+		{
+			for ( int i = 0; i < 4; i++ )
+			{
+				RandomFill( num1 [ i ], &seed );
+				num2 [ i ] = RandomU64( &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		s16 rc = div_uT64_x4( quotients, remainders, dividends, num2 );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// four div_uT64 calls, back to back, the work of one div_uT64_x4
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Div64_4Calls( )
+	{
+		alignas ( 64 ) u64 num1 [ 4 ] [ 8 ] { };
+		alignas ( 64 ) u64 quotient [ 4 ] [ 8 ] { };
+		u64 num2 [ 4 ] = { 54760, 54761, 54762, 54763 };
+		u64 remainder [ 4 ] = { 0 };
+		if ( !pipeline_test )
+		{
+			for ( int i = 0; i < 4; i++ )
+			{
+				RandomFill( num1 [ i ], &seed );
+				num2 [ i ] = RandomU64( &seed );
+			};
+		}
+		u64 start = TimerStart( );
+		s16 rc = div_uT64( quotient [ 0 ], &remainder [ 0 ], num1 [ 0 ], num2 [ 0 ] );
+		rc = div_uT64( quotient [ 1 ], &remainder [ 1 ], num1 [ 1 ], num2 [ 1 ] );
+		rc = div_uT64( quotient [ 2 ], &remainder [ 2 ], num1 [ 2 ], num2 [ 2 ] );
+		rc = div_uT64( quotient [ 3 ], &remainder [ 3 ], num1 [ 3 ], num2 [ 3 ] );
+		return ( TimerStop( ) - start );
+	};
+
+	/// <summary>
+	/// Operand pool for the throughput runs: pool_size pseudo-random operands of each kind, 64 byte aligned, generated once;
+	/// each kind 32K bytes, so the few a kernel reads stay in L2, and the run times the kernel, not the memory.
+	/// Call j takes operands [ j ] and writes results [ j ]: no call waits on the one before it
+	/// </summary>
+	const int pool_size = 512;
+	const int pool_mask = pool_size - 1;
+
+	struct operand_pool
+	{
+		alignas ( 64 ) u64 a [ pool_size ] [ 8 ];
+		alignas ( 64 ) u64 b [ pool_size ] [ 8 ];
+		alignas ( 64 ) u64 reduced_a [ pool_size ] [ 8 ];		// top bit clear: less than the Montgomery modulus
+		alignas ( 64 ) u64 reduced_b [ pool_size ] [ 8 ];
+		alignas ( 64 ) u64 dividend [ pool_size ] [ 8 ];		// shaped as DurationTest_Div's
+		alignas ( 64 ) u64 divisor [ pool_size ] [ 8 ];
+		alignas ( 64 ) u64 result [ pool_size ] [ 8 ];
+		alignas ( 64 ) u64 result2 [ pool_size ] [ 8 ];
+		u64 q [ pool_size ];									// 64 bit operands, odd ( never a zero divisor )
+		u64 q_result [ pool_size ];
+		char decimal [ pool_size ] [ ui512_decimal_max + 1 ];	// operand a [ j ] as text
+		s16 decimal_len [ pool_size ];
+		char hex [ pool_size ] [ ui512_hex_chars + 1 ];
+		char text [ pool_size ] [ ui512_decimal_max + 1 ];		// text results
+	};
+
+	operand_pool* Pool( )
+	{
+		static operand_pool* pool = nullptr;
+		if ( pool == nullptr )
+		{
+			pool = new operand_pool;
+			u64 pseed = 0;
+			for ( int j = 0; j < pool_size; j++ )
+			{
+				RandomFill( pool->a [ j ], &pseed );
+				RandomFill( pool->b [ j ], &pseed );
+				copy_u( pool->reduced_a [ j ], pool->a [ j ] );
+				pool->reduced_a [ j ] [ 0 ] &= 0x7FFFFFFFFFFFFFFFull;
+				copy_u( pool->reduced_b [ j ], pool->b [ j ] );
+				pool->reduced_b [ j ] [ 0 ] &= 0x7FFFFFFFFFFFFFFFull;
+				copy_u( pool->dividend [ j ], pool->a [ j ] );
+				pool->dividend [ j ] [ 0 ] = 0;
+				pool->dividend [ j ] [ 1 ] &= 0x000FFFFFFFFFull;
+				copy_u( pool->divisor [ j ], pool->b [ j ] );
+				pool->divisor [ j ] [ 0 ] = 0;
+				pool->divisor [ j ] [ 1 ] = 0;
+				pool->divisor [ j ] [ 7 ] |= 1ull;
+				pool->q [ j ] = RandomU64( &pseed ) | 1ull;
+				pool->decimal_len [ j ] = to_decimal( pool->decimal [ j ], ui512_decimal_max + 1, pool->a [ j ] );
+				to_hex( pool->hex [ j ], pool->a [ j ] );
+			};
+		};
+		return pool;
+	};
+
+	/// <summary>
+	/// Whether this host can run the kernel: the MULX / ADX multiplies need BMI2 and ADX; the rest run anywhere
+	/// </summary>
+	/// <param name="test_sel">kernel</param>
+	/// <returns>true if the kernel can be timed here</returns>
+	bool PerfTestSupported( Perf_Tests test_sel )
+	{
+		return ( test_sel != MulAdx && test_sel != Mul64Adx ) || ui512_mulx_supported( );
+	};
+
+	/// <summary>
+	/// Throughput: stat->timing_count calls back to back over the operand pool, after a warm up of one pass.
+	/// Calls are independent, so the core overlaps them as far as it can: clock cycles per call here is the issue rate, not the latency.
+	/// Each call is one indirect call of a small wrapper ( well predicted ), counted as the calling set-up is in the latency figures
+	/// </summary>
+	/// <param name="stat">timing_count in; throughput_cycles, throughput_per_second out</param>
+	/// <param name="test_sel">kernel</param>
+	/// <param name="report">log the figures</param>
+	void RunThroughput( perf_stats* stat, Perf_Tests test_sel, bool report )
+	{
+		if ( !PerfTestSupported( test_sel ) )
+		{
+			stat->throughput_cycles = 0.0;
+			stat->throughput_per_second = 0.0;
+			if ( report )
+			{
+				Logger::WriteMessage( ( "***\t\t\t" + TestName [ test_sel ] + ", throughput\t\t\t***\nHost lacks BMI2 or ADX; not run.\n\n" ).c_str( ) );
+			};
+			return;
+		};
+		static operand_pool* P = Pool( );
+		// for reference: enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb, MontMul, MontSqr, BarrettMod, BarrettMod1024, Div64Pre, Mod64, ToDecimal, FromDecimal, ToHex, FromHex, Sqr, MulLo, MulHi, MulAdx, Mul64Adx, PowModWindow, PowModLadder, ModInv, ModInvVar, GcdBinary, GcdLehmer, GcdEuclid, Isqrt, IsqrtBits, Iroot3, PerfectPower, BatchAdd, AddX8, BatchMul, MulX8, BatchTranspose, MulX4, Mul4Calls, Div64X4, Div64_4Calls };
+		typedef void( *poolop )( int j );
+		poolop ops [ ] = {
+			[ ] ( int j ) { compare_u( P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { compare_uT64( P->a [ j ], P->q [ j ] ); },
+			[ ] ( int j ) { add_u( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { add_u_wc( P->result [ j ], P->a [ j ], P->b [ j ], s16( j & 1 ) ); },
+			[ ] ( int j ) { add_uT64( P->result [ j ], P->a [ j ], P->q [ j ] ); },
+			[ ] ( int j ) { sub_u( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { sub_u_wb( P->result [ j ], P->a [ j ], P->b [ j ], s16( j & 1 ) ); },
+			[ ] ( int j ) { sub_uT64( P->result [ j ], P->a [ j ], P->q [ j ] ); },
+			[ ] ( int j ) { mult_u( P->result [ j ], P->result2 [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { mult_uT64( P->result [ j ], &P->q_result [ j ], P->a [ j ], P->q [ j ] ); },
+			[ ] ( int j ) { div_u( P->result [ j ], P->result2 [ j ], P->dividend [ j ], P->divisor [ j ] ); },
+			[ ] ( int j ) { div_uT64( P->result [ j ], &P->q_result [ j ], P->a [ j ], P->q [ j ] ); },
+			[ ] ( int j ) { and_u( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { or_u( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { xor_u( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { not_u( P->result [ j ], P->a [ j ] ); },
+			[ ] ( int j ) { shl_u( P->result [ j ], P->a [ j ], 180 ); },
+			[ ] ( int j ) { shr_u( P->result [ j ], P->a [ j ], 180 ); },
+			[ ] ( int j ) { msb_u( P->a [ j ] ); },
+			[ ] ( int j ) { lsb_u( P->a [ j ] ); },
+			[ ] ( int j ) { mont_mul( P->result [ j ], P->reduced_a [ j ], P->reduced_b [ j ], DurationTest_MontCtx( ) ); },
+			[ ] ( int j ) { mont_sqr( P->result [ j ], P->reduced_a [ j ], DurationTest_MontCtx( ) ); },
+			[ ] ( int j ) { barrett_mod( P->result [ j ], P->dividend [ j ], DurationTest_BarrettCtx( ) ); },
+			[ ] ( int j ) { barrett_mod_1024( P->result [ j ], P->a [ j ], P->b [ j ], DurationTest_BarrettCtx( ) ); },
+			[ ] ( int j ) { div_uT64_pre( P->result [ j ], &P->q_result [ j ], P->a [ j ], DurationTest_Div64Ctx( ) ); },
+			[ ] ( int j ) { P->q_result [ j ] = mod_uT64( P->a [ j ], DurationTest_Div64Ctx( ) ); },
+			[ ] ( int j ) { to_decimal( P->text [ j ], ui512_decimal_max + 1, P->a [ j ] ); },
+			[ ] ( int j ) { from_decimal( P->result [ j ], P->decimal [ j ], P->decimal_len [ j ] ); },
+			[ ] ( int j ) { to_hex( P->text [ j ], P->a [ j ] ); },
+			[ ] ( int j ) { from_hex( P->result [ j ], P->hex [ j ], ui512_hex_chars ); },
+			[ ] ( int j ) { sqr_u( P->result [ j ], P->result2 [ j ], P->a [ j ] ); },
+			[ ] ( int j ) { mult_u_lo( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { mult_u_hi( P->result2 [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { mult_u_adx( P->result [ j ], P->result2 [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { mult_uT64_adx( P->result [ j ], &P->q_result [ j ], P->a [ j ], P->q [ j ] ); },
+			[ ] ( int j ) { mont_pow( P->result [ j ], P->a [ j ], P->b [ j ], DurationTest_MontCtx( ), powmod_window ); },
+			[ ] ( int j ) { mont_pow( P->result [ j ], P->a [ j ], P->b [ j ], DurationTest_MontCtx( ), powmod_ladder ); },
+			[ ] ( int j ) { modinv_u( P->result [ j ], P->a [ j ], DurationTest_MontCtx( )->modulus ); },
+			[ ] ( int j ) { modinv_u_var( P->result [ j ], P->a [ j ], DurationTest_MontCtx( )->modulus ); },
+			[ ] ( int j ) { gcd_u( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j ) { gcd_u_lehmer( P->result [ j ], P->a [ j ], P->b [ j ] ); },
+			[ ] ( int j )
+			{
+				_UI512( num1 ) { 0 };
+				_UI512( num2 ) { 0 };
+				copy_u( num1, P->a [ j ] );
+				copy_u( num2, P->b [ j ] );
+				while ( compare_uT64( num2, 0ull ) != 0 )
+				{
+					div_u( P->result [ j ], P->result2 [ j ], num1, num2 );
+					copy_u( num1, num2 );
+					copy_u( num2, P->result2 [ j ] );
+				};
+			},
+			[ ] ( int j ) { isqrt_u( P->result [ j ], P->a [ j ] ); },
+			[ ] ( int j ) { IsqrtBitwise( P->result [ j ], P->a [ j ] ); },
+			[ ] ( int j ) { iroot_u( P->result [ j ], P->a [ j ], 3 ); },
+			[ ] ( int j ) { u32 exponent = 0; is_perfect_power_u( P->result [ j ], &exponent, P->a [ j ] ); },
+			// batch and four at a time: call j takes the eight ( four ) numbers from [ 8j ] ( [ 4j ] ), around the pool
+			[ ] ( int j ) { int k = ( 8 * j ) & pool_mask; batch_add( ( ui512_batch* ) P->result [ k ], ( const ui512_batch* ) P->a [ k ], ( const ui512_batch* ) P->b [ k ] ); },
+			[ ] ( int j )
+			{
+				int k = ( 8 * j ) & pool_mask;
+				for ( int i = k; i < k + 8; i++ )
+				{
+					add_u( P->result [ i ], P->a [ i ], P->b [ i ] );
+				};
+			},
+			[ ] ( int j )
+			{
+				int k = ( 8 * j ) & pool_mask;
+				batch_mul( ( ui512_batch* ) P->result [ k ], ( ui512_batch* ) P->result2 [ k ], ( const ui512_batch* ) P->a [ k ], ( const ui512_batch* ) P->b [ k ] );
+			},
+			[ ] ( int j )
+			{
+				int k = ( 8 * j ) & pool_mask;
+				for ( int i = k; i < k + 8; i++ )
+				{
+					mult_u( P->result [ i ], P->result2 [ i ], P->a [ i ], P->b [ i ] );
+				};
+			},
+			[ ] ( int j )
+			{
+				int k = ( 8 * j ) & pool_mask;
+				batch_load( ( ui512_batch* ) P->result [ k ], P->a [ k ] );
+				batch_store( P->result2 [ k ], ( const ui512_batch* ) P->result [ k ] );
+			},
+			[ ] ( int j )
+			{
+				int k = ( 4 * j ) & pool_mask;
+				u64* products [ 4 ] = { P->result [ k ], P->result [ k + 1 ], P->result [ k + 2 ], P->result [ k + 3 ] };
+				u64* overflows [ 4 ] = { P->result2 [ k ], P->result2 [ k + 1 ], P->result2 [ k + 2 ], P->result2 [ k + 3 ] };
+				const u64* multiplicands [ 4 ] = { P->a [ k ], P->a [ k + 1 ], P->a [ k + 2 ], P->a [ k + 3 ] };
+				const u64* multipliers [ 4 ] = { P->b [ k ], P->b [ k + 1 ], P->b [ k + 2 ], P->b [ k + 3 ] };
+				mult_u_x4( products, overflows, multiplicands, multipliers );
+			},
+			[ ] ( int j )
+			{
+				int k = ( 4 * j ) & pool_mask;
+				for ( int i = k; i < k + 4; i++ )
+				{
+					mult_u( P->result [ i ], P->result2 [ i ], P->a [ i ], P->b [ i ] );
+				};
+			},
+			[ ] ( int j )
+			{
+				int k = ( 4 * j ) & pool_mask;
+				u64* quotients [ 4 ] = { P->result [ k ], P->result [ k + 1 ], P->result [ k + 2 ], P->result [ k + 3 ] };
+				u64* remainders [ 4 ] = { &P->q_result [ k ], &P->q_result [ k + 1 ], &P->q_result [ k + 2 ], &P->q_result [ k + 3 ] };
+				const u64* dividends [ 4 ] = { P->a [ k ], P->a [ k + 1 ], P->a [ k + 2 ], P->a [ k + 3 ] };
+				div_uT64_x4( quotients, remainders, dividends, &P->q [ k ] );
+			},
+			[ ] ( int j )
+			{
+				int k = ( 4 * j ) & pool_mask;
+				for ( int i = k; i < k + 4; i++ )
+				{
+					div_uT64( P->result [ i ], &P->q_result [ i ], P->a [ i ], P->q [ i ] );
+				};
+			}
+		};
+		poolop op = ops [ test_sel ];
+
+		for ( int j = 0; j < pool_size; j++ )
+		{
+			op( j );
+		};
+		auto wall_start = chrono::steady_clock::now( );
+		u64 start = TimerStart( );
+		for ( int i = 0; i < stat->timing_count; i++ )
+		{
+			op( i & pool_mask );
+		};
+		u64 cycles = TimerStop( ) - start;
+		double seconds = chrono::duration<double>( chrono::steady_clock::now( ) - wall_start ).count( );
+
+		stat->throughput_cycles = double( cycles ) / double( stat->timing_count );
+		stat->throughput_per_second = ( seconds > 0.0 ) ? double( stat->timing_count ) / seconds : 0.0;
+
+		if ( !report )
+		{
+			return;
+		};
+		string test_message = "***\t\t\t" + TestName [ test_sel ] + ", throughput\t\t\t***\n";
+		test_message += format( "Calls run back to back, over {:d} operands:\t{:9d}\n", pool_size, stat->timing_count );
+		test_message += format( "Clock cycles per call ( throughput ): \t{:6.2f}\n", stat->throughput_cycles );
+		test_message += format( "Calls per second: \t\t\t\t\t{:12.0f}\n\n", stat->throughput_per_second );
+		Logger::WriteMessage( test_message.c_str( ) );
+	};
+
+	/// <summary>
+	/// Chain state: each call's output, or a value picked by it, is the next call's input. Kernels whose time does not depend on the
+	/// values ( add, mul, logic, shifts ) feed the result straight back: x = add_u( x, y ), x = mult_u_lo( x, y ). Those that do
+	/// ( divide, gcd, roots, text ), or whose results would shrink to nothing fed back ( a remainder is less than its divisor, the high
+	/// half of x * y less than x ), use a low bit of the result to pick the next operand, one of two from the pool: the next call's
+	/// loads wait on the result, but each call does the same sort of work the latency samples do. The multiplies are not documented
+	/// as safe in place, so those chains write the buffer they did not read, and swap: in, out, x, x2, by turns
+	/// </summary>
+	struct chain_state
+	{
+		alignas ( 64 ) u64 x [ 8 ];								// fed back
+		alignas ( 64 ) u64 x2 [ 8 ];							// x's partner, for the chains that do not work in place
+		alignas ( 64 ) u64 y [ 8 ];								// constant operand
+		alignas ( 64 ) u64 z [ 8 ];								// second output ( overflow, quotient )
+		alignas ( 64 ) u64 w [ 8 ];								// result whose low bit picks the next operand
+		u64* in;												// x or x2: the one last written
+		u64* out;												// the other
+		ui512_batch bx;											// fed back, eight numbers ( or eight rows of a _UI512 each )
+		ui512_batch bx2;										// bx's partner
+		ui512_batch by;
+		ui512_batch bz;
+		ui512_batch* bin;										// bx or bx2, as in and out
+		ui512_batch* bout;
+		char text [ ui512_decimal_max + 1 ];
+		u64 q;
+		u64 r [ 4 ];
+		s64 rc;
+	};
+
+	/// <summary>
+	/// Latency over a dependent chain: stat->timing_count calls, each waiting on the one before, between one pair of timestamps.
+	/// No timestamp per call, so no timestamp overhead in the figure; what remains is the kernel's latency, the call and its
+	/// store to load forwarding of the result ( as in any caller that uses the result ), and, for the picked operand chains, one load
+	/// and a mask. Against RunThroughput's figure for the same kernel: how much the core overlaps independent calls
+	/// </summary>
+	/// <param name="stat">timing_count in; chain_cycles out</param>
+	/// <param name="test_sel">kernel</param>
+	/// <param name="report">log the figures</param>
+	void RunChain( perf_stats* stat, Perf_Tests test_sel, bool report )
+	{
+		if ( !PerfTestSupported( test_sel ) )
+		{
+			stat->chain_cycles = 0.0;
+			if ( report )
+			{
+				Logger::WriteMessage( ( "***\t\t\t" + TestName [ test_sel ] + ", latency, dependent chain\t\t\t***\nHost lacks BMI2 or ADX; not run.\n\n" ).c_str( ) );
+			};
+			return;
+		};
+		static operand_pool* P = Pool( );
+		static chain_state* C = new chain_state;
+		// for reference: enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb, MontMul, MontSqr, BarrettMod, BarrettMod1024, Div64Pre, Mod64, ToDecimal, FromDecimal, ToHex, FromHex, Sqr, MulLo, MulHi, MulAdx, Mul64Adx, PowModWindow, PowModLadder, ModInv, ModInvVar, GcdBinary, GcdLehmer, GcdEuclid, Isqrt, IsqrtBits, Iroot3, PerfectPower, BatchAdd, AddX8, BatchMul, MulX8, BatchTranspose, MulX4, Mul4Calls, Div64X4, Div64_4Calls };
+		typedef void( *chainop )( );
+		chainop ops [ ] = {
+			[ ] ( ) { C->rc = compare_u( P->a [ C->rc & 1 ], P->b [ 0 ] ); },
+			[ ] ( ) { C->rc = compare_uT64( P->a [ C->rc & 1 ], P->q [ 0 ] ); },
+			[ ] ( ) { add_u( C->x, C->x, C->y ); },
+			[ ] ( ) { C->rc = add_u_wc( C->x, C->x, C->y, s16( C->rc ) ); },
+			[ ] ( ) { add_uT64( C->x, C->x, C->q ); },
+			[ ] ( ) { sub_u( C->x, C->x, C->y ); },
+			[ ] ( ) { C->rc = sub_u_wb( C->x, C->x, C->y, s16( C->rc ) ); },
+			[ ] ( ) { sub_uT64( C->x, C->x, C->q ); },
+			[ ] ( ) { mult_u( C->out, C->z, C->in, C->y ); std::swap( C->in, C->out ); },
+			[ ] ( ) { mult_uT64( C->out, &C->r [ 0 ], C->in, C->q ); std::swap( C->in, C->out ); },
+			[ ] ( ) { div_u( C->z, C->w, P->dividend [ C->w [ 7 ] & 1 ], P->divisor [ 0 ] ); },
+			[ ] ( ) { div_uT64( C->z, &C->r [ 0 ], P->a [ C->r [ 0 ] & 1 ], P->q [ 0 ] ); },
+			[ ] ( ) { and_u( C->x, C->x, C->y ); },
+			[ ] ( ) { or_u( C->x, C->x, C->y ); },
+			[ ] ( ) { xor_u( C->x, C->x, C->y ); },
+			[ ] ( ) { not_u( C->x, C->x ); },
+			[ ] ( ) { shl_u( C->x, C->x, 180 ); },
+			[ ] ( ) { shr_u( C->x, C->x, 180 ); },
+			[ ] ( ) { C->rc = msb_u( P->a [ C->rc & 1 ] ); },
+			[ ] ( ) { C->rc = lsb_u( P->a [ C->rc & 1 ] ); },
+			[ ] ( ) { mont_mul( C->out, C->in, C->y, DurationTest_MontCtx( ) ); std::swap( C->in, C->out ); },
+			[ ] ( ) { mont_sqr( C->out, C->in, DurationTest_MontCtx( ) ); std::swap( C->in, C->out ); },
+			[ ] ( ) { barrett_mod( C->w, P->dividend [ C->w [ 7 ] & 1 ], DurationTest_BarrettCtx( ) ); },
+			[ ] ( ) { barrett_mod_1024( C->w, P->a [ C->w [ 7 ] & 1 ], P->b [ 0 ], DurationTest_BarrettCtx( ) ); },
+			[ ] ( ) { div_uT64_pre( C->z, &C->r [ 0 ], P->a [ C->r [ 0 ] & 1 ], DurationTest_Div64Ctx( ) ); },
+			[ ] ( ) { C->r [ 0 ] = mod_uT64( P->a [ C->r [ 0 ] & 1 ], DurationTest_Div64Ctx( ) ); },
+			[ ] ( ) { C->rc = to_decimal( C->text, ui512_decimal_max + 1, P->a [ C->rc & 1 ] ); },
+			[ ] ( ) { from_decimal( C->w, P->decimal [ C->w [ 7 ] & 1 ], P->decimal_len [ C->w [ 7 ] & 1 ] ); },
+			[ ] ( ) { to_hex( C->text, P->a [ C->text [ ui512_hex_chars - 1 ] & 1 ] ); },
+			[ ] ( ) { from_hex( C->w, P->hex [ C->w [ 7 ] & 1 ], ui512_hex_chars ); },
+			[ ] ( ) { sqr_u( C->out, C->z, C->in ); std::swap( C->in, C->out ); },
+			[ ] ( ) { mult_u_lo( C->out, C->in, C->y ); std::swap( C->in, C->out ); },
+			[ ] ( ) { mult_u_hi( C->w, P->a [ C->w [ 7 ] & 1 ], C->y ); },
+			[ ] ( ) { mult_u_adx( C->out, C->z, C->in, C->y ); std::swap( C->in, C->out ); },
+			[ ] ( ) { mult_uT64_adx( C->out, &C->r [ 0 ], C->in, C->q ); std::swap( C->in, C->out ); },
+			[ ] ( ) { mont_pow( C->w, P->a [ C->w [ 7 ] & 1 ], P->b [ 0 ], DurationTest_MontCtx( ), powmod_window ); },
+			[ ] ( ) { mont_pow( C->w, P->a [ C->w [ 7 ] & 1 ], P->b [ 0 ], DurationTest_MontCtx( ), powmod_ladder ); },
+			[ ] ( ) { modinv_u( C->w, P->a [ C->w [ 7 ] & 1 ], DurationTest_MontCtx( )->modulus ); },
+			[ ] ( ) { modinv_u_var( C->w, P->a [ C->w [ 7 ] & 1 ], DurationTest_MontCtx( )->modulus ); },
+			[ ] ( ) { gcd_u( C->w, P->a [ C->w [ 7 ] & 1 ], P->b [ 0 ] ); },
+			[ ] ( ) { gcd_u_lehmer( C->w, P->a [ C->w [ 7 ] & 1 ], P->b [ 0 ] ); },
+			[ ] ( )
+			{
+				_UI512( num1 ) { 0 };
+				_UI512( num2 ) { 0 };
+				copy_u( num1, P->a [ C->w [ 7 ] & 1 ] );
+				copy_u( num2, P->b [ 0 ] );
+				while ( compare_uT64( num2, 0ull ) != 0 )
+				{
+					div_u( C->z, C->w, num1, num2 );
+					copy_u( num1, num2 );
+					copy_u( num2, C->w );
+				};
+				copy_u( C->w, num1 );
+			},
+			[ ] ( ) { isqrt_u( C->w, P->a [ C->w [ 7 ] & 1 ] ); },
+			[ ] ( ) { IsqrtBitwise( C->w, P->a [ C->w [ 7 ] & 1 ] ); },
+			[ ] ( ) { iroot_u( C->w, P->a [ C->w [ 7 ] & 1 ], 3 ); },
+			[ ] ( ) { u32 exponent = 0; is_perfect_power_u( C->w, &exponent, P->a [ C->w [ 7 ] & 1 ] ); },
+			// batch and four at a time: eight ( four ) chains side by side, each number fed back into its own
+			[ ] ( ) { batch_add( &C->bx, &C->bx, &C->by ); },
+			[ ] ( )
+			{
+				for ( int i = 0; i < 8; i++ )
+				{
+					add_u( C->bx.limb [ i ], C->bx.limb [ i ], C->by.limb [ i ] );
+				};
+			},
+			[ ] ( ) { batch_mul( &C->bx, &C->bz, &C->bx, &C->by ); },
+			[ ] ( )
+			{
+				for ( int i = 0; i < 8; i++ )
+				{
+					mult_u( C->bout->limb [ i ], C->bz.limb [ i ], C->bin->limb [ i ], C->by.limb [ i ] );
+				};
+				std::swap( C->bin, C->bout );
+			},
+			[ ] ( )
+			{
+				batch_load( &C->bz, C->bx.limb [ 0 ] );
+				batch_store( C->bx.limb [ 0 ], &C->bz );
+			},
+			[ ] ( )
+			{
+				u64* products [ 4 ] = { C->bx.limb [ 0 ], C->bx.limb [ 1 ], C->bx.limb [ 2 ], C->bx.limb [ 3 ] };
+				u64* overflows [ 4 ] = { C->bz.limb [ 0 ], C->bz.limb [ 1 ], C->bz.limb [ 2 ], C->bz.limb [ 3 ] };
+				const u64* multiplicands [ 4 ] = { C->bx.limb [ 0 ], C->bx.limb [ 1 ], C->bx.limb [ 2 ], C->bx.limb [ 3 ] };
+				const u64* multipliers [ 4 ] = { C->by.limb [ 0 ], C->by.limb [ 1 ], C->by.limb [ 2 ], C->by.limb [ 3 ] };
+				mult_u_x4( products, overflows, multiplicands, multipliers );
+			},
+			[ ] ( )
+			{
+				for ( int i = 0; i < 4; i++ )
+				{
+					mult_u( C->bout->limb [ i ], C->bz.limb [ i ], C->bin->limb [ i ], C->by.limb [ i ] );
+				};
+				std::swap( C->bin, C->bout );
+			},
+			[ ] ( )
+			{
+				int k = int( C->r [ 0 ] & 1 ) * 4;
+				u64* quotients [ 4 ] = { C->bz.limb [ 0 ], C->bz.limb [ 1 ], C->bz.limb [ 2 ], C->bz.limb [ 3 ] };
+				u64* remainders [ 4 ] = { &C->r [ 0 ], &C->r [ 1 ], &C->r [ 2 ], &C->r [ 3 ] };
+				const u64* dividends [ 4 ] = { P->a [ k ], P->a [ k + 1 ], P->a [ k + 2 ], P->a [ k + 3 ] };
+				div_uT64_x4( quotients, remainders, dividends, &P->q [ 0 ] );
+			},
+			[ ] ( )
+			{
+				for ( int i = 0; i < 4; i++ )
+				{
+					div_uT64( C->bz.limb [ i ], &C->r [ i ], P->a [ 4 * ( C->r [ i ] & 1 ) + i ], P->q [ i ] );
+				};
+			}
+		};
+		chainop op = ops [ test_sel ];
+
+		// same start for every kernel: odd operands ( odd products stay odd ), below the Montgomery modulus
+		copy_u( C->x, P->reduced_a [ 0 ] );
+		C->x [ 7 ] |= 1ull;
+		copy_u( C->y, P->reduced_b [ 0 ] );
+		C->y [ 7 ] |= 1ull;
+		zero_u( C->z );
+		zero_u( C->w );
+		for ( int i = 0; i < 8; i++ )
+		{
+			copy_u( C->bx.limb [ i ], P->reduced_a [ 8 + i ] );
+			copy_u( C->by.limb [ i ], P->reduced_b [ 8 + i ] );
+			C->by.limb [ i ] [ 7 ] |= 1ull;
+		};
+		C->text [ ui512_hex_chars - 1 ] = '0';
+		C->q = P->q [ 0 ];
+		C->r [ 0 ] = C->r [ 1 ] = C->r [ 2 ] = C->r [ 3 ] = 0;
+		C->rc = 0;
+		C->in = C->x;
+		C->out = C->x2;
+		C->bin = &C->bx;
+		C->bout = &C->bx2;
+
+		for ( int j = 0; j < pool_size; j++ )
+		{
+			op( );
+		};
+		auto wall_start = chrono::steady_clock::now( );
+		u64 start = TimerStart( );
+		for ( int i = 0; i < stat->timing_count; i++ )
+		{
+			op( );
+		};
+		u64 cycles = TimerStop( ) - start;
+		double seconds = chrono::duration<double>( chrono::steady_clock::now( ) - wall_start ).count( );
+
+		stat->chain_cycles = double( cycles ) / double( stat->timing_count );
+
+		if ( !report )
+		{
+			return;
+		};
+		string test_message = "***\t\t\t" + TestName [ test_sel ] + ", latency, dependent chain\t\t\t***\n";
+		test_message += format( "Calls in the chain:\t\t\t\t\t\t{:9d}\n", stat->timing_count );
+		test_message += format( "Clock cycles per call ( latency ): \t\t{:6.2f}\n", stat->chain_cycles );
+		test_message += format( "Nanoseconds per call: \t\t\t\t\t{:6.2f}\n\n", seconds * 1.0e9 / double( stat->timing_count ) );
+		Logger::WriteMessage( test_message.c_str( ) );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <param name="stat"></param>
+	/// <param name="test_sel"></param>
+	void RunStats( perf_stats* stat, Perf_Tests test_sel )
+	{
+		if ( !PerfTestSupported( test_sel ) )
+		{
+			Logger::WriteMessage( ( "***\t\t\t" + TestName [ test_sel ] + "\t\t\t***\nHost lacks BMI2 or ADX; not run.\n\n" ).c_str( ) );
+			return;
+		};
+		if ( Perf_Mode & perf_mode_throughput )
+		{
+			RunThroughput( stat, test_sel, true );
+		};
+		if ( Perf_Mode & perf_mode_chain )
+		{
+			RunChain( stat, test_sel, true );
+		};
+		if ( !( Perf_Mode & perf_mode_latency ) )
+		{
+			return;
+		};
+
+		double duration = 0;
+		stat->x_i = new std::vector<double>( stat->timing_count );
+		stat->z_score = new std::vector<double>( stat->timing_count );
+		stat->outliers = new std::vector<outlier>( 0 );
+		// for reference: enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb, MontMul, MontSqr, BarrettMod, BarrettMod1024, Div64Pre, Mod64, ToDecimal, FromDecimal, ToHex, FromHex, Sqr, MulLo, MulHi, MulAdx, Mul64Adx, PowModWindow, PowModLadder, ModInv, ModInvVar, GcdBinary, GcdLehmer, GcdEuclid, Isqrt, IsqrtBits, Iroot3, PerfectPower, BatchAdd, AddX8, BatchMul, MulX8, BatchTranspose, MulX4, Mul4Calls, Div64X4, Div64_4Calls };
+		typedef u64( *targettest )( );
+		targettest targets [ ] = {
+			&DurationTest_Comp, &DurationTest_Comp64,
+			&DurationTest_Add, &DurationTest_AddwC, &DurationTest_Add64,
+			&DurationTest_Sub, &DurationTest_Subwb, &DurationTest_Sub64,
+			&DurationTest_Mul, &DurationTest_Mul64,
+			&DurationTest_Div, &DurationTest_Div64,
+			&DurationTest_And, &DurationTest_Or,
+			&DurationTest_Xor, &DurationTest_Not,
+			&DurationTest_Shl, &DurationTest_Shr,
+			&DurationTest_msb, &DurationTest_lsb,
+			&DurationTest_MontMul, &DurationTest_MontSqr,
+			&DurationTest_BarrettMod, &DurationTest_BarrettMod1024,
+			&DurationTest_Div64Pre, &DurationTest_Mod64,
+			&DurationTest_ToDecimal, &DurationTest_FromDecimal,
+			&DurationTest_ToHex, &DurationTest_FromHex,
+			&DurationTest_Sqr, &DurationTest_MulLo, &DurationTest_MulHi,
+			&DurationTest_MulAdx, &DurationTest_Mul64Adx,
+			&DurationTest_PowModWindow, &DurationTest_PowModLadder,
+			&DurationTest_ModInv, &DurationTest_ModInvVar,
+			&DurationTest_GcdBinary, &DurationTest_GcdLehmer, &DurationTest_GcdEuclid,
+			&DurationTest_Isqrt, &DurationTest_IsqrtBits, &DurationTest_Iroot3, &DurationTest_PerfectPower,
+			&DurationTest_BatchAdd, &DurationTest_AddX8, &DurationTest_BatchMul, &DurationTest_MulX8, &DurationTest_BatchTranspose,
+			&DurationTest_MulX4, &DurationTest_Mul4Calls, &DurationTest_Div64X4, &DurationTest_Div64_4Calls
+		};
+
+		for ( int i = 0; i < warm_up_count; i++ ) {
+			duration = ( double ) targets [ test_sel ]( );
+		}
+		// Run target function timing_count times, capturing each duration, also getting min, max, and total duration spent
+
+		for ( int i = 0; i < stat->timing_count; i++ )
+		{
+			duration = ( double ) targets [ test_sel ]( );
+			stat->min = ( duration < stat->min ) ? duration : stat->min;
+			stat->max = ( duration > stat->max ) ? duration : stat->max;
+			stat->total += duration;
+			stat->x_i->at( i ) = duration;
+		};
+
+		// Calculate mean, population variance, standard deviation, coefficient of variation, and z-scores
+		{
+			stat->mean = stat->total / double( stat->timing_count );
+			for ( int i = 0; i < stat->timing_count; i++ )
+			{
+				double deviation = stat->x_i->at( i ) - stat->mean;
+				stat->sample_variance += deviation * deviation;
+			};
+
+			stat->sample_variance /= ( double( stat->timing_count ) - 1.0 );
+			stat->stddev = sqrt( stat->sample_variance );
+			stat->coefficient_of_variation = ( stat->mean != 0.0 ) ? ( stat->stddev / stat->mean ) * 100.0 : 0.0;
+			stat->timer_overhead = Timer_Overhead;
+			stat->corrected_mean = ( stat->mean > Timer_Overhead ) ? stat->mean - Timer_Overhead : 0.0;
+			stat->corrected_min = ( stat->min > Timer_Overhead ) ? stat->min - Timer_Overhead : 0.0;
+			for ( int i = 0; i < stat->timing_count; i++ )
+			{
+				stat->z_score->at( i ) = ( stat->stddev != 0.0 ) ? ( stat->x_i->at( i ) - stat->mean ) / stat->stddev : 0.0;
+			};
+
+			string test_message = "***\t\t\t" + TestName [ test_sel ] + "\t\t\t***\n";
+			test_message += format( "Samples run:\t\t\t\t{:9d}\n", stat->timing_count );
+			test_message += format( "Total target function (including c calling set - up) execution cycles :{:10.0f}\n", stat->total );
+			test_message += format( "Average clock cycles per call: \t{:6.2f}\n", stat->mean );
+			test_message += format( "Minimum in \t\t\t\t\t\t{:6.0f}\n", stat->min );
+			test_message += format( "Maximum in \t\t\t\t\t\t{:6.0f}\n", stat->max );
+			test_message += format( "Timer overhead ( empty measurement ):\t{:6.0f}\n", stat->timer_overhead );
+			test_message += format( "Average, less timer overhead: \t{:6.2f}\n", stat->corrected_mean );
+			test_message += format( "Minimum, less timer overhead: \t{:6.0f}\n", stat->corrected_min );
+			test_message += format( "Sample Variance: \t\t\t{:10.3f}\n", stat->sample_variance );
+			test_message += format( "Standard Deviation :\t \t{:9.3f}\n", stat->stddev );
+			test_message += format( "Coefficient of Variation: \t{:10.2f}\n\n", stat->coefficient_of_variation );
+
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		// Identify outliers, based on outlier_threshold
+		stat->outlier_threshold = 3.0 * stat->stddev;
+		for ( int i = 0; i < stat->timing_count; i++ )
+		{
+			double z_sc = stat->z_score->at( i );
+			double abs_z_score = ( z_sc < 0.0 ) ? -z_sc : z_sc;
+
+			if ( abs_z_score > 3.0 )
+			{
+				outlier o;
+				o.iteration = i;
+				o.duration = stat->x_i->at( i );
+				o.z_score = z_sc;
+				stat->outliers->push_back( o );
+			};
+		};
+
+		// Report on outliers, if any
+		// Note: in a normal distribution, 99.7% of all values will be within three standard deviations of the mean
+		// Thus, any value outside that range is an outlier
+		// In this test, we are looking for unexpected occurrences of outliers, which may indicate some kind of
+		// external interference in the timing test (such as OS activity, etc)
+		// If the number of outliers is small (say under 1% of total), then it is likely not a problem
+		// If the number of outliers is larger (say over 5% of total), then there may be a problem with the test environment
+		// We're determining 'average' (mean) performance as measured in clock cycles.
+		// The relaibility of the user achieving that average is higher if the deviation from mean is low,
+		// and the number of exceptional deviations (outliers) is low.
+
+		// Note: some functions may have a bi-modal distribution, in which case you must temper the results of the outlier test.
+		// for example, mult_u has a propagating carry loop, which may cause a bi-modal distribution, or at least a widening of the distribution
+		// Further, the CPU clock penalty of starting AVX instructions on some processors may cause outliers
+		//
+		double outlier_percentage = ( double ) ( stat->outliers->size( ) * 100.0 ) / ( double ) stat->timing_count;
+		double range_low = stat->mean - ( 3.0 * stat->stddev );
+		range_low = ( range_low < 0.0 ) ? 0.0 : range_low;
+		double range_high = stat->mean + ( 3.0 * stat->stddev );
+
+		if ( stat->outliers->size( ) > 0 )
+		{
+			string test_message = _MSGA( "Identified " << stat->outliers->size( ) << " outlier(s), based on a threshold of "
+				<< stat->outlier_threshold << " which is three standard deviations from the mean of " << stat->mean << " clock cycles.\n" );
+			test_message += _MSGA( "Samples with cycles from " << range_low << " to " << range_high << ", are within that range.\n" );
+			test_message += format( "Samples within this range are considered normal and contain {:6.3f}% of the samples.\n", ( 100.0 - outlier_percentage ) );
+			test_message += "Samples outside this range are considered outliers. ";
+			test_message += format( "This represents {:4.3f}% of the samples.", outlier_percentage );
+			test_message += "\nTested via Assert that the percentage of outliers is below 2%\n";
+			test_message += "\nUp to the first 20 are shown. z_score is the number of standards of deviation the outlier varies from the mean.\n\n";
+			test_message += " Iteration | Clock Cycles  |      Z Score  |\n";
+			test_message += "-----------|---------------|---------------|\n";
+
+			s32 outlier_limit = 20;
+			s32 count = 0;
+
+			for ( int i = 0; i < stat->outliers->size( ) && i < outlier_limit; i++ ) {
+				outlier o = stat->outliers->at( i );
+				test_message += format( "{:10d} |", o.iteration );
+				test_message += format( "{:13.0f}  |", o.duration );
+				test_message += format( "{:13.3f}  |", o.z_score );
+				test_message += "\n";
+			};
+			test_message += "\n";
+
+			Assert::IsTrue( outlier_percentage < 2.0, L"Too many outliers, over 2% of total sample" );
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		// End of batch
+		stat->x_i->clear( );
+		delete stat->x_i;
+		stat->z_score->clear( );
+		delete stat->z_score;
+		stat->outliers->clear( );
+		delete stat->outliers;
+		return;
+	};
+
+	TEST_CLASS( ui512_unit_tests )
+	{
+		TEST_METHOD( random_number_generator )
+		{
+			//	Check distribution of "random" numbers
+			u64 seed = 0;
+			const u32 dec = 10;
+			u32 dist [ dec ] { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+			const u64 split = primeLT64 / dec;
+			u32 distc = 0;
 			float varsum = 0.0;
 			float deviation = 0.0;
 			float D = 0.0;
@@ -686,5 +2086,40 @@ namespace ui512_Unit_Tests
 			msgchi += '\n';
 			Logger::WriteMessage( msgchi.c_str( ) );
 		};
+
+		TEST_METHOD( perf_summary )
+		{
+			// Latency and throughput of every kernel in Perf_Tests: latency over a dependent chain of calls ( see RunChain ),
+			// throughput back to back over the operand pool ( see RunThroughput ).
+			// Calls per kernel are scaled to about 20 million clock cycles of work, from a short probe run, up to timing_count.
+			// Kernels this host can not run ( MULX / ADX without BMI2 or ADX ) are listed n/a.
+			// Note: not pass/fail, informational only
+
+			const int tests = int( sizeof( TestName ) / sizeof( TestName [ 0 ] ) );
+			string test_message = format( "Latency ( dependent chain ) and throughput ( back to back over {:d} operands ), every kernel.\n\n", pool_size );
+			test_message += " Kernel                                                        |     Calls  | Latency, cycles | Throughput, cycles |   Calls / second |\n";
+			test_message += "---------------------------------------------------------------|------------|-----------------|--------------------|------------------|\n";
+			for ( int t = 0; t < tests; t++ )
+			{
+				if ( !PerfTestSupported( Perf_Tests( t ) ) )
+				{
+					test_message += format( " {:61s} | {:>10s} | {:>15s} | {:>18s} | {:>16s} |\n", TestName [ t ], "n/a", "n/a", "n/a", "n/a" );
+					continue;
+				};
+				perf_stats probe = Perf_Test_Parms [ 0 ];
+				probe.timing_count = 64;
+				RunChain( &probe, Perf_Tests( t ), false );
+				double calls = 2.0e7 / ( ( probe.chain_cycles > 1.0 ) ? probe.chain_cycles : 1.0 );
+
+				perf_stats stat = Perf_Test_Parms [ 0 ];
+				stat.timing_count = ( calls < 64.0 ) ? 64 : ( calls > double( timing_count ) ) ? timing_count : s32( calls );
+				RunChain( &stat, Perf_Tests( t ), false );
+				RunThroughput( &stat, Perf_Tests( t ), false );
+				test_message += format( " {:61s} | {:10d} | {:15.2f} | {:18.2f} | {:16.0f} |\n", TestName [ t ], stat.timing_count, stat.chain_cycles,
+					stat.throughput_cycles, stat.throughput_per_second );
+			};
+			test_message += "\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
 	};
 };
@@ -0,0 +1,265 @@
+//		ui512_unit_tests_accumulator
+//
+//		File:			ui512_unit_tests_accumulator.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_accumulator.h"
+#include "ui512_unit_tests.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_accumulator )
+	{
+		// ( hi, lo ) += v, 1024 bits
+		static void Add1024( u64* lo, u64* hi, const u64* v )
+		{
+			s16 carry = add_u( lo, lo, v );
+			add_uT64( hi, hi, u64( carry ) );
+		};
+
+		// ( hi, lo ) compared to ( hi2, lo2 )
+		static int Compare1024( const u64* lo, const u64* hi, const u64* lo2, const u64* hi2 )
+		{
+			int c = compare_u( hi, hi2 );
+			return ( c != 0 ) ? c : compare_u( lo, lo2 );
+		};
+
+		TEST_METHOD( ui512acc_01_accumulator )
+		{
+			ui512_accumulator acc;
+			_UI512( sum ) { 0 };
+			_UI512( overflow ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( expected_hi ) { 0 };
+			_UI512( value ) { 0 };
+
+			// 1. layout: each shard whole cache lines; refused shard count
+			Assert::AreEqual( size_t( 0 ), sizeof( ui512_shard ) % 64, L"Shard size not a multiple of a cache line" );
+			Assert::AreEqual( size_t( 64 ), alignof( ui512_shard ), L"Shard alignment not a cache line" );
+			Assert::AreEqual( s16( -1 ), acc_init( &acc, 0 ), L"Return code failed zero shards" );
+
+			// 2. one thread: 512 and 64 bit adds, into every shard by turns, with carries ( values near 2^512 )
+			u64 seed = 0;
+			Assert::AreEqual( s16( 0 ), acc_init( &acc, 5 ), L"Return code failed init" );
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( value, &seed );
+				if ( i % 3 == 0 )
+				{
+					std::fill_n( value, 7, u64_Max );
+				};
+				acc_add_u( &acc, i % 5, value );
+				Add1024( expected, expected_hi, value );
+				u64 v64 = RandomU64( &seed );
+				acc_add_uT64( &acc, ( i + 2 ) % 5, v64 );
+				set_uT64( value, v64 );
+				Add1024( expected, expected_hi, value );
+			};
+			acc_read( &acc, sum, overflow );
+			Assert::AreEqual( 0, Compare1024( sum, overflow, expected, expected_hi ), L"Single thread total failed" );
+			Assert::AreEqual( 1, compare_uT64( overflow, 0ull ), L"Single thread total did not carry" );
+			acc_clear( &acc );
+			acc_read( &acc, sum, overflow );
+			Assert::AreEqual( 0, compare_uT64( sum, 0ull ), L"Clear failed" );
+			Assert::AreEqual( 0, compare_uT64( overflow, 0ull ), L"Clear failed overflow" );
+			acc_release( &acc );
+
+			// 3. threads: each adds its own pseudo-random sequence into its own shard, while a reader checks the total never goes back
+			int threads = int( std::thread::hardware_concurrency( ) );
+			threads = ( threads < 2 ) ? 2 : ( threads > 16 ) ? 16 : threads;
+			const int adds = 100000;
+			acc_init( &acc, threads );
+			std::atomic<int> running { threads };
+			std::atomic<bool> backwards { false };
+			std::vector<std::thread> pool;
+			for ( int t = 0; t < threads; t++ )
+			{
+				pool.emplace_back( [ &acc, &running, t, adds ] ( )
+					{
+						u64 tseed = u64( t + 1 ) * 0x9E3779B97F4A7C15ull;
+						_UI512( v ) { 0 };
+						for ( int i = 0; i < adds; i++ )
+						{
+							if ( i & 1 )
+							{
+								acc_add_uT64( &acc, t, RandomU64( &tseed ) );
+							}
+							else
+							{
+								RandomFill( v, &tseed );
+								shr_u( v, v, 8 );
+								acc_add_u( &acc, t, v );
+							};
+						};
+						running--;
+					} );
+			};
+			std::thread reader( [ &acc, &running, &backwards ] ( )
+				{
+					_UI512( lo ) { 0 };
+					_UI512( hi ) { 0 };
+					_UI512( last_lo ) { 0 };
+					_UI512( last_hi ) { 0 };
+					while ( running.load( ) > 0 )
+					{
+						acc_read( &acc, lo, hi );
+						if ( Compare1024( lo, hi, last_lo, last_hi ) < 0 )
+						{
+							backwards = true;
+						};
+						copy_u( last_lo, lo );
+						copy_u( last_hi, hi );
+					};
+				} );
+			for ( auto& th : pool )
+			{
+				th.join( );
+			};
+			reader.join( );
+
+			zero_u( expected );
+			zero_u( expected_hi );
+			for ( int t = 0; t < threads; t++ )
+			{
+				u64 tseed = u64( t + 1 ) * 0x9E3779B97F4A7C15ull;
+				for ( int i = 0; i < adds; i++ )
+				{
+					if ( i & 1 )
+					{
+						set_uT64( value, RandomU64( &tseed ) );
+					}
+					else
+					{
+						RandomFill( value, &tseed );
+						shr_u( value, value, 8 );
+					};
+					Add1024( expected, expected_hi, value );
+				};
+			};
+			acc_read( &acc, sum, overflow );
+			Assert::IsFalse( backwards.load( ), L"Concurrent read went backwards" );
+			Assert::AreEqual( 0, Compare1024( sum, overflow, expected, expected_hi ), L"Threaded total failed" );
+			acc_release( &acc );
+
+			string test_message = _MSGA( "Sharded accumulator testing. Layout; " << test_run_count << " single thread adds with carries; "
+				<< threads << " threads of " << adds << " adds each, with a concurrent reader.\n" );
+			test_message += "Passed. Totals verified against serial 1024 bit sums, concurrent reads never decreasing; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512acc_02_scaling_performance )
+		{
+			// Performance timing, by thread count. Not pass/fail, informational only.
+			// Each thread makes the same count of 64 bit adds: into its own shard, then for comparison into one total under a mutex.
+			// Wall clock ( steady_clock ) for the slowest thread; ideal scaling keeps adds per microsecond rising with the thread count.
+
+			const int adds = 1 << 20;
+			int max_threads = int( std::thread::hardware_concurrency( ) );
+			max_threads = ( max_threads < 1 ) ? 1 : max_threads;
+
+			string test_message = _MSGA( "Sharded accumulator scaling test, " << adds << " 64 bit adds per thread, up to " << max_threads << " threads.\n" );
+			test_message += "threads\tsharded adds/us\tspeed up\tlocked adds/us\tspeed up\n";
+			double sharded_one = 0;
+			double locked_one = 0;
+			// 1, 2, 4 ... and the core count
+			std::vector<int> counts;
+			for ( int threads = 1; threads < max_threads; threads *= 2 )
+			{
+				counts.push_back( threads );
+			};
+			counts.push_back( max_threads );
+			for ( int threads : counts )
+			{
+				ui512_accumulator acc;
+				acc_init( &acc, threads );
+				std::vector<std::thread> pool;
+				auto start = std::chrono::steady_clock::now( );
+				for ( int t = 0; t < threads; t++ )
+				{
+					pool.emplace_back( [ &acc, t, adds ] ( )
+						{
+							u64 tseed = u64( t + 1 );
+							for ( int i = 0; i < adds; i++ )
+							{
+								acc_add_uT64( &acc, t, RandomU64( &tseed ) );
+							};
+						} );
+				};
+				for ( auto& th : pool )
+				{
+					th.join( );
+				};
+				double us = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+				acc_release( &acc );
+				double sharded = double( adds ) * threads / us;
+
+				std::mutex lock;
+				_UI512( total ) { 0 };
+				pool.clear( );
+				start = std::chrono::steady_clock::now( );
+				for ( int t = 0; t < threads; t++ )
+				{
+					pool.emplace_back( [ &lock, &total, t, adds ] ( )
+						{
+							u64 tseed = u64( t + 1 );
+							for ( int i = 0; i < adds; i++ )
+							{
+								u64 v = RandomU64( &tseed );
+								std::lock_guard<std::mutex> guard( lock );
+								add_uT64( total, total, v );
+							};
+						} );
+				};
+				for ( auto& th : pool )
+				{
+					th.join( );
+				};
+				us = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+				double locked = double( adds ) * threads / us;
+
+				sharded_one = ( threads == 1 ) ? sharded : sharded_one;
+				locked_one = ( threads == 1 ) ? locked : locked_one;
+				test_message += _MSGA( threads << "\t" << sharded << "\t\t" << sharded / sharded_one << "\t\t" << locked << "\t\t" << locked / locked_one << "\n" );
+			};
+			test_message += "\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+	};
+};
@@ -0,0 +1,227 @@
+//		ui512_unit_tests_batch
+//
+//		File:			ui512_unit_tests_batch.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_batch.h"
+#include "ui512_unit_tests.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_batch )
+	{
+		// eight pseudo-random numbers, some lanes forced to edge values ( all ones, zero, one, equal to the other operand's lane ) by pattern
+		static void FillEdges( u64* numbers, u64* seed, int pattern )
+		{
+			for ( int lane = 0; lane < 8; lane++ )
+			{
+				u64* x = numbers + lane * 8;
+				RandomFill( x, seed );
+				switch ( ( lane + pattern ) % 11 )
+				{
+				case 0:
+					std::fill_n( x, 8, u64_Max );
+					break;
+				case 1:
+					zero_u( x );
+					break;
+				case 2:
+					set_uT64( x, 1ull );
+					break;
+				case 3:
+					shr_u( x, x, u16( 64 * ( pattern % 8 ) ) );
+					break;
+				default:
+					break;
+				};
+			};
+		};
+
+		TEST_METHOD( ui512batch_01_kernels )
+		{
+			alignas ( 64 ) static u64 x [ 8 ] [ 8 ];
+			alignas ( 64 ) static u64 y [ 8 ] [ 8 ];
+			alignas ( 64 ) static u64 r [ 8 ] [ 8 ];
+			alignas ( 64 ) static u64 r2 [ 8 ] [ 8 ];
+			ui512_batch bx;
+			ui512_batch by;
+			ui512_batch br;
+			ui512_batch br2;
+			_UI512( expected ) { 0 };
+			_UI512( expected2 ) { 0 };
+			u64 seed = 0;
+
+			// 1. layout; transpose round trip, and each limb where it belongs
+			Assert::AreEqual( size_t( 512 ), sizeof( ui512_batch ), L"Batch size failed" );
+			Assert::AreEqual( size_t( 64 ), alignof( ui512_batch ), L"Batch alignment failed" );
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				FillEdges( &x [ 0 ] [ 0 ], &seed, i );
+				batch_load( &bx, &x [ 0 ] [ 0 ] );
+				for ( int lane = 0; lane < 8; lane++ )
+				{
+					for ( int k = 0; k < 8; k++ )
+					{
+						Assert::AreEqual( x [ lane ] [ k ], bx.limb [ k ] [ lane ], _MSGW( L"Load failed at lane " << lane << L" limb " << k ) );
+					};
+				};
+				batch_store( &r [ 0 ] [ 0 ], &bx );
+				for ( int lane = 0; lane < 8; lane++ )
+				{
+					Assert::AreEqual( 0, compare_u( r [ lane ], x [ lane ] ), _MSGW( L"Store failed at lane " << lane ) );
+				};
+			};
+
+			// 2. add, subtract, multiply, compare: every lane against the single number kernel
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				FillEdges( &x [ 0 ] [ 0 ], &seed, i );
+				FillEdges( &y [ 0 ] [ 0 ], &seed, i + 5 );
+				if ( i % 4 == 0 )
+				{
+					copy_u( y [ i % 8 ], x [ i % 8 ] );
+				};
+				batch_load( &bx, &x [ 0 ] [ 0 ] );
+				batch_load( &by, &y [ 0 ] [ 0 ] );
+
+				u16 carry = batch_add( &br, &bx, &by );
+				batch_store( &r [ 0 ] [ 0 ], &br );
+				for ( int lane = 0; lane < 8; lane++ )
+				{
+					s16 c = add_u( expected, x [ lane ], y [ lane ] );
+					Assert::AreEqual( 0, compare_u( r [ lane ], expected ), _MSGW( L"Add failed at lane " << lane ) );
+					Assert::AreEqual( u16( c ), u16( ( carry >> lane ) & 1 ), _MSGW( L"Add carry failed at lane " << lane ) );
+				};
+
+				u16 borrow = batch_sub( &br, &bx, &by );
+				batch_store( &r [ 0 ] [ 0 ], &br );
+				for ( int lane = 0; lane < 8; lane++ )
+				{
+					s16 b = sub_u( expected, x [ lane ], y [ lane ] );
+					Assert::AreEqual( 0, compare_u( r [ lane ], expected ), _MSGW( L"Subtract failed at lane " << lane ) );
+					Assert::AreEqual( u16( b ), u16( ( borrow >> lane ) & 1 ), _MSGW( L"Subtract borrow failed at lane " << lane ) );
+				};
+
+				batch_mul( &br, &br2, &bx, &by );
+				batch_store( &r [ 0 ] [ 0 ], &br );
+				batch_store( &r2 [ 0 ] [ 0 ], &br2 );
+				for ( int lane = 0; lane < 8; lane++ )
+				{
+					mult_u( expected, expected2, x [ lane ], y [ lane ] );
+					Assert::AreEqual( 0, compare_u( r [ lane ], expected ), _MSGW( L"Multiply product failed at lane " << lane ) );
+					Assert::AreEqual( 0, compare_u( r2 [ lane ], expected2 ), _MSGW( L"Multiply overflow failed at lane " << lane ) );
+				};
+
+				u16 less = 0;
+				u16 equal = 0;
+				batch_compare( &less, &equal, &bx, &by );
+				for ( int lane = 0; lane < 8; lane++ )
+				{
+					s16 c = compare_u( x [ lane ], y [ lane ] );
+					Assert::AreEqual( u16( c < 0 ), u16( ( less >> lane ) & 1 ), _MSGW( L"Compare less failed at lane " << lane ) );
+					Assert::AreEqual( u16( c == 0 ), u16( ( equal >> lane ) & 1 ), _MSGW( L"Compare equal failed at lane " << lane ) );
+				};
+			};
+
+			// 3. shifts: every count 0 to 511, in place, against the single number kernels; 512 and over to zero
+			FillEdges( &x [ 0 ] [ 0 ], &seed, 4 );
+			batch_load( &bx, &x [ 0 ] [ 0 ] );
+			for ( u16 shift = 0; shift < 520; shift++ )
+			{
+				br = bx;
+				batch_shl( &br, &br, shift );
+				batch_store( &r [ 0 ] [ 0 ], &br );
+				batch_shr( &br2, &bx, shift );
+				batch_store( &r2 [ 0 ] [ 0 ], &br2 );
+				for ( int lane = 0; lane < 8; lane++ )
+				{
+					if ( shift < 512 )
+					{
+						shl_u( expected, x [ lane ], shift );
+						shr_u( expected2, x [ lane ], shift );
+					}
+					else
+					{
+						zero_u( expected );
+						zero_u( expected2 );
+					};
+					Assert::AreEqual( 0, compare_u( r [ lane ], expected ), _MSGW( L"Shift left failed at lane " << lane << L" by " << shift ) );
+					Assert::AreEqual( 0, compare_u( r2 [ lane ], expected2 ), _MSGW( L"Shift right failed at lane " << lane << L" by " << shift ) );
+				};
+			};
+
+			string test_message = _MSGA( "Batch kernel testing. Layout; transpose in and out; " << test_run_count
+				<< " batches of add, subtract, multiply, compare with edge lanes; shifts by 0 to 519.\n" );
+			test_message += "Passed. Every lane verified against the single number kernels; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512batch_02_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Each sample is eight numbers: the batch call against eight calls of the single number kernel. Sample counts are cut by 10.
+
+			const Perf_Tests tests [ 5 ] = { BatchAdd, AddX8, BatchMul, MulX8, BatchTranspose };
+			const wchar_t* titles [ 5 ] = {
+				L"Batch add ( eight numbers per call ) performance timing test.\n\n",
+				L"Add, eight calls of add_u, performance timing test, for comparison.\n\n",
+				L"Batch multiply ( eight numbers per call ) performance timing test.\n\n",
+				L"Multiply, eight calls of mult_u, performance timing test, for comparison.\n\n",
+				L"Batch transpose ( load and store of eight numbers ) performance timing test.\n\n" };
+			for ( int t = 0; t < 5; t++ )
+			{
+				Logger::WriteMessage( titles [ t ] );
+
+				Logger::WriteMessage( L"First run.\n" );
+				perf_stats No1 = Perf_Test_Parms [ 0 ];
+				No1.timing_count /= 10;
+				RunStats( &No1, tests [ t ] );
+
+				Logger::WriteMessage( L"Second run.\n" );
+				perf_stats No2 = Perf_Test_Parms [ 1 ];
+				No2.timing_count /= 10;
+				RunStats( &No2, tests [ t ] );
+
+				Logger::WriteMessage( L"Third run.\n" );
+				perf_stats No3 = Perf_Test_Parms [ 2 ];
+				No3.timing_count /= 10;
+				RunStats( &No3, tests [ t ] );
+			};
+		};
+	};
+};
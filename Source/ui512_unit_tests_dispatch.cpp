@@ -0,0 +1,242 @@
+//		ui512_unit_tests_dispatch
+//
+//		File:			ui512_unit_tests_dispatch.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_dispatch.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	/// <summary>
+	/// Run every kernel in table "k" against the same kernel in reference table "ref", with the same pseudo-random operands.
+	/// Results (and return codes) must be identical.
+	/// </summary>
+	/// <param name="ref">reference variant kernel table</param>
+	/// <param name="k">variant kernel table under test</param>
+	/// <param name="seed">seed for random number generator</param>
+	void CrossCheckVariants( const ui512_kernels* ref, const ui512_kernels* k, u64* seed )
+	{
+		_UI512( num1 ) { 0 };
+		_UI512( num2 ) { 0 };
+		_UI512( expected ) { 0 };
+		_UI512( expected2 ) { 0 };
+		_UI512( result ) { 0 };
+		_UI512( result2 ) { 0 };
+
+		for ( int i = 0; i < test_run_count; i++ )
+		{
+			RandomFill( num1, seed );
+			RandomFill( num2, seed );
+			u64 val = RandomU64( seed );
+			u16 nrShift = u16( RandomU64( seed ) % 512 );
+			shr_u( num2, num2, u16( RandomU64( seed ) % 512 ) );	// vary the significance of the right hand operand
+			u64 divisor64 = RandomU64( seed );
+			divisor64 = ( divisor64 == 0 ) ? 1 : divisor64;
+
+			ref->zero_u( expected );
+			k->zero_u( result );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"zero_u variant " << k->name << " at word #" << j << " differs on run #" << i ) );
+			};
+
+			ref->copy_u( expected, num1 );
+			k->copy_u( result, num1 );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"copy_u variant " << k->name << " at word #" << j << " differs on run #" << i ) );
+			};
+
+			ref->set_uT64( expected, val );
+			k->set_uT64( result, val );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"set_uT64 variant " << k->name << " at word #" << j << " differs on run #" << i ) );
+			};
+
+			Assert::AreEqual( ref->compare_u( num1, num2 ), k->compare_u( num1, num2 ), _MSGW( L"compare_u variant " << k->name << " differs on run #" << i ) );
+			Assert::AreEqual( ref->compare_u( num1, num1 ), k->compare_u( num1, num1 ), _MSGW( L"compare_u (equal) variant " << k->name << " differs on run #" << i ) );
+			Assert::AreEqual( ref->compare_uT64( num2, val ), k->compare_uT64( num2, val ), _MSGW( L"compare_uT64 variant " << k->name << " differs on run #" << i ) );
+
+			// kernels with a 512 bit result share one check: expected / result hold the 512 bit result, along with the return codes
+			auto check = [ & ] ( const char* kernel, s16 expected_rc, s16 rc )
+				{
+					Assert::AreEqual( expected_rc, rc, _MSGW( kernel << L" variant " << k->name << " return code differs on run #" << i ) );
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expected [ j ], result [ j ], _MSGW( kernel << L" variant " << k->name << " at word #" << j << " differs on run #" << i ) );
+					};
+				};
+
+			check( "add_u", ref->add_u( expected, num1, num2 ), k->add_u( result, num1, num2 ) );
+			check( "add_u_wc", ref->add_u_wc( expected, num1, num2, 1 ), k->add_u_wc( result, num1, num2, 1 ) );
+			check( "add_uT64", ref->add_uT64( expected, num1, val ), k->add_uT64( result, num1, val ) );
+			check( "sub_u", ref->sub_u( expected, num1, num2 ), k->sub_u( result, num1, num2 ) );
+			check( "sub_u_wb", ref->sub_u_wb( expected, num1, num2, 1 ), k->sub_u_wb( result, num1, num2, 1 ) );
+			check( "sub_uT64", ref->sub_uT64( expected, num1, val ), k->sub_uT64( result, num1, val ) );
+
+			{
+				u64 expectedovfl = 0;
+				u64 ovfl = 0;
+				check( "mult_uT64", ref->mult_uT64( expected, &expectedovfl, num1, val ), k->mult_uT64( result, &ovfl, num1, val ) );
+				Assert::AreEqual( expectedovfl, ovfl, _MSGW( L"mult_uT64 variant " << k->name << " overflow differs on run #" << i ) );
+			}
+
+			check( "mult_u", ref->mult_u( expected, expected2, num1, num2 ), k->mult_u( result, result2, num1, num2 ) );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected2 [ j ], result2 [ j ], _MSGW( L"mult_u variant " << k->name << " overflow at word #" << j << " differs on run #" << i ) );
+			};
+
+			{
+				u64 expectedrem = 0;
+				u64 rem = 0;
+				check( "div_uT64", ref->div_uT64( expected, &expectedrem, num1, divisor64 ), k->div_uT64( result, &rem, num1, divisor64 ) );
+				Assert::AreEqual( expectedrem, rem, _MSGW( L"div_uT64 variant " << k->name << " remainder differs on run #" << i ) );
+			}
+
+			if ( compare_uT64( num2, 0 ) != 0 )
+			{
+				check( "div_u", ref->div_u( expected, expected2, num1, num2 ), k->div_u( result, result2, num1, num2 ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected2 [ j ], result2 [ j ], _MSGW( L"div_u variant " << k->name << " remainder at word #" << j << " differs on run #" << i ) );
+				};
+			};
+
+			Assert::AreEqual( ref->msb_u( num2 ), k->msb_u( num2 ), _MSGW( L"msb_u variant " << k->name << " differs on run #" << i ) );
+			Assert::AreEqual( ref->lsb_u( num2 ), k->lsb_u( num2 ), _MSGW( L"lsb_u variant " << k->name << " differs on run #" << i ) );
+
+			ref->shr_u( expected, num1, nrShift );
+			k->shr_u( result, num1, nrShift );
+			check( "shr_u", 0, 0 );
+			ref->shl_u( expected, num1, nrShift );
+			k->shl_u( result, num1, nrShift );
+			check( "shl_u", 0, 0 );
+			ref->and_u( expected, num1, num2 );
+			k->and_u( result, num1, num2 );
+			check( "and_u", 0, 0 );
+			ref->or_u( expected, num1, num2 );
+			k->or_u( result, num1, num2 );
+			check( "or_u", 0, 0 );
+			ref->xor_u( expected, num1, num2 );
+			k->xor_u( result, num1, num2 );
+			check( "xor_u", 0, 0 );
+			ref->not_u( expected, num1 );
+			k->not_u( result, num1 );
+			check( "not_u", 0, 0 );
+		};
+	};
+
+	TEST_CLASS( ui512_unit_tests_dispatch )
+	{
+		TEST_METHOD( ui512_01_dispatch_select )
+		{
+			const ui512_cpu_features& f = ui512_cpu( );
+			string test_message = "Runtime variant dispatch. Host processor features:\n";
+			test_message += _MSGA( "\tSSE4.1: " << f.sse41 << "\tAVX2: " << f.avx2 << "\tAVX-512 F/BW/VL: " << f.avx512f << "/" << f.avx512bw << "/" << f.avx512vl
+				<< "\tBMI2: " << f.bmi2 << "\tADX: " << f.adx << "\n" );
+
+			Assert::IsTrue( ui512k != nullptr, L"No kernel table selected" );
+			Assert::IsTrue( ui512_variant_supported( ui512_Q ), L"Q (64 bit) variant must always be supported" );
+
+			// The selected table must be the widest variant that is both in the library and supported by the host
+			const ui512_kernels* widest = nullptr;
+			for ( int v = ui512_Z; v >= ui512_Q; v-- )
+			{
+				const ui512_kernels* k = ui512_variant_kernels( ui512_variant( v ) );
+				test_message += _MSGA( "\tVariant " << v << ": " << ( ui512_variant_supported( ui512_variant( v ) ) ? "supported by host" : "not supported by host" )
+					<< ( k != nullptr ? ", in library\n" : "\n" ) );
+				widest = ( widest == nullptr ) ? k : widest;
+			};
+			// With MULX / ADX, the selected table is a copy of that variant, with the dual carry chain multiplies
+			if ( widest != nullptr && !ui512_mulx_supported( ) )
+			{
+				Assert::IsTrue( ui512k == widest, L"Selected kernel table is not the widest supported variant" );
+			};
+			if ( widest != nullptr && ui512_mulx_supported( ) )
+			{
+				Assert::IsTrue( ui512k->variant == widest->variant, L"Selected kernel table is not the widest supported variant" );
+				Assert::IsTrue( ui512k->mult_u == &mult_u_adx, L"MULX / ADX multiply not selected" );
+				Assert::IsTrue( ui512k->mult_uT64 == &mult_uT64_adx, L"MULX / ADX multiply by 64 bit not selected" );
+				Assert::IsTrue( ui512k->add_u == widest->add_u, L"Selected kernel table differs from its variant beyond the multiplies" );
+			};
+
+			test_message += _MSGA( "Selected: " << ui512k->name << "\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested selection via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512_02_dispatch_cross_variant )
+		{
+			// Each supported variant is run against the narrowest supported variant (normally Q), kernel by kernel, with the same operands
+			u64 seed = 0;
+			const ui512_kernels* ref = nullptr;
+			int checked = 0;
+			string test_message = "Runtime variant dispatch. Cross variant testing.\n";
+
+			for ( int v = ui512_Q; v < ui512_variant_count; v++ )
+			{
+				const ui512_kernels* k = ui512_variant_kernels( ui512_variant( v ) );
+				if ( k == nullptr )
+				{
+					continue;
+				};
+				if ( ref == nullptr )
+				{
+					ref = k;
+				};
+				CrossCheckVariants( ref, k, &seed );
+				test_message += _MSGA( "\t" << k->name << " against " << ref->name << ": " << test_run_count << " times, each kernel, with pseudo random values.\n" );
+				checked++;
+			};
+
+			Assert::IsTrue( checked > 0, L"No variant available to test" );
+			if ( ui512_mulx_supported( ) )
+			{
+				CrossCheckVariants( ref, ui512k, &seed );
+				test_message += _MSGA( "\t" << ui512k->name << " against " << ref->name << ": " << test_run_count << " times, each kernel, with pseudo random values.\n" );
+			};
+			if ( checked == 1 )
+			{
+				test_message += "\tOnly one variant in this library; checked against itself. Assemble with all variants (__ui512_MultiVariant) to cross check.\n";
+			};
+
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, returned values: each via assert.\n\n" );
+		};
+	};	// test_class
+};	// namespace
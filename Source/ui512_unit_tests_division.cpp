@@ -32,6 +32,7 @@
 
 #include "CppUnitTest.h"
 #include "ui512_externs.h"
+#include "ui512_barrett.h"
 #include "ui512_unit_tests.h"
 #include <cstring>
 #include <format>
@@ -409,6 +410,178 @@ namespace ui512_Unit_Tests
 			RunStats( &No3, Div );
 		};
 
+		TEST_METHOD( ui512_05_barrett )
+		{
+			u64 seed = 0;
+			barrett_ctx ctx;
+			_UI512( dividend ) { 0 };
+			_UI512( overflow ) { 0 };
+			_UI512( divisor ) { 0 };
+			_UI512( expectedquotient ) { 0 };
+			_UI512( expectedremainder ) { 0 };
+			_UI512( quotient ) { 0 };
+			_UI512( quotient_overflow ) { 0 };
+			_UI512( remainder ) { 0 };
+			_UI512( zero ) { 0 };
+			_UI512( lo ) { 0 };
+			_UI512( hi ) { 0 };
+
+			// 1. zero divisor is refused
+			s16 retcode = barrett_init( &ctx, zero );
+			Assert::AreEqual( s16( -1 ), retcode, L"Return code failed zero divisor" );
+
+			// 2. edge divisors ( one, 2^511, 2^512 - 1 ), random 512 bit dividends, against div_u
+			for ( int edge = 0; edge < 3; edge++ )
+			{
+				zero_u( divisor );
+				switch ( edge )
+				{
+				case 0: divisor [ 7 ] = 1ull; break;
+				case 1: divisor [ 0 ] = 0x8000000000000000ull; break;
+				case 2: not_u( divisor, zero ); break;
+				};
+				retcode = barrett_init( &ctx, divisor );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed edge divisor #" << edge ) );
+				for ( int i = 0; i < test_run_count; i++ )
+				{
+					RandomFill( dividend, &seed );
+					div_u( expectedquotient, expectedremainder, dividend, divisor );
+					barrett_divmod( quotient, remainder, dividend, &ctx );
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expectedquotient [ j ], quotient [ j ],
+							_MSGW( L"Quotient at word #" << j << " failed edge divisor #" << edge << " on run #" << i ) );
+						Assert::AreEqual( expectedremainder [ j ], remainder [ j ],
+							_MSGW( L"Remainder at word #" << j << " failed edge divisor #" << edge << " on run #" << i ) );
+					};
+				};
+			};
+
+			// 3. random divisors of every bit length, random 512 bit dividends, against div_u
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( divisor, &seed );
+				shr_u( divisor, divisor, u16( i % 512 ) );
+				divisor [ 7 ] |= 1ull;
+				barrett_init( &ctx, divisor );
+				RandomFill( dividend, &seed );
+				div_u( expectedquotient, expectedremainder, dividend, divisor );
+				barrett_divmod( quotient, remainder, dividend, &ctx );
+				barrett_mod( lo, dividend, &ctx );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedquotient [ j ], quotient [ j ],
+						_MSGW( L"Quotient at word #" << j << " failed random divisor on run #" << i ) );
+					Assert::AreEqual( expectedremainder [ j ], remainder [ j ],
+						_MSGW( L"Remainder at word #" << j << " failed random divisor on run #" << i ) );
+					Assert::AreEqual( expectedremainder [ j ], lo [ j ],
+						_MSGW( L"Mod at word #" << j << " failed random divisor on run #" << i ) );
+				};
+			};
+
+			// 4. 1024 bit dividends with known quotient and remainder: dividend = q * d + r, r < d
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( divisor, &seed );
+				shr_u( divisor, divisor, u16( i % 512 ) );
+				divisor [ 7 ] |= 1ull;
+				barrett_init( &ctx, divisor );
+				RandomFill( expectedquotient, &seed );
+				RandomFill( lo, &seed );
+				div_u( hi, expectedremainder, lo, divisor );
+				mult_u( dividend, overflow, expectedquotient, divisor );
+				s16 carry = add_u( dividend, dividend, expectedremainder );
+				add_uT64( overflow, overflow, u64( carry ) );
+				barrett_divmod_1024( quotient, quotient_overflow, remainder, dividend, overflow, &ctx );
+				barrett_mod_1024( lo, dividend, overflow, &ctx );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( 0ull, quotient_overflow [ j ],
+						_MSGW( L"Quotient overflow at word #" << j << " failed q * d + r on run #" << i ) );
+					Assert::AreEqual( expectedquotient [ j ], quotient [ j ],
+						_MSGW( L"Quotient at word #" << j << " failed q * d + r on run #" << i ) );
+					Assert::AreEqual( expectedremainder [ j ], remainder [ j ],
+						_MSGW( L"Remainder at word #" << j << " failed q * d + r on run #" << i ) );
+					Assert::AreEqual( expectedremainder [ j ], lo [ j ],
+						_MSGW( L"Mod at word #" << j << " failed q * d + r on run #" << i ) );
+				};
+			};
+
+			// 5. random 1024 bit dividends ( quotient may exceed 512 bits ): verify quotient * d + remainder == dividend, remainder < d
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( divisor, &seed );
+				shr_u( divisor, divisor, u16( i % 512 ) );
+				divisor [ 7 ] |= 1ull;
+				barrett_init( &ctx, divisor );
+				RandomFill( dividend, &seed );
+				RandomFill( overflow, &seed );
+				barrett_divmod_1024( quotient, quotient_overflow, remainder, dividend, overflow, &ctx );
+				Assert::IsTrue( compare_u( remainder, divisor ) < 0, _MSGW( L"Remainder not less than divisor on run #" << i ) );
+
+				// ( quotient_overflow * B + quotient ) * d + remainder, B = 2^512: the top digit must be zero
+				_UI512( qd_lo ) { 0 };
+				_UI512( qd_mid ) { 0 };
+				_UI512( qod_lo ) { 0 };
+				_UI512( qod_hi ) { 0 };
+				mult_u( qd_lo, qd_mid, quotient, divisor );
+				mult_u( qod_lo, qod_hi, quotient_overflow, divisor );
+				s16 carry = add_u( lo, qd_lo, remainder );
+				s16 carry_hi = add_u_wc( hi, qd_mid, qod_lo, carry );
+				Assert::AreEqual( s16( 0 ), carry_hi, _MSGW( L"Quotient * divisor + remainder exceeds 1024 bits on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( 0ull, qod_hi [ j ],
+						_MSGW( L"Quotient * divisor exceeds 1024 bits at word #" << j << " on run #" << i ) );
+					Assert::AreEqual( dividend [ j ], lo [ j ],
+						_MSGW( L"Quotient * divisor + remainder low at word #" << j << " failed on run #" << i ) );
+					Assert::AreEqual( overflow [ j ], hi [ j ],
+						_MSGW( L"Quotient * divisor + remainder high at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Barrett reduction function testing. Ran tests " << test_run_count * 6 + 1 << " times, each with pseudo-random values.\n" );
+			test_message += "Passed. 512 bit results verified against div_u; 1024 bit results verified by known quotient and by q * d + r; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512_06_barrett_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// The 512 bit case uses the same dividend / divisor shapes as ui512_04_div_performance, with the divisor fixed, for a direct comparison
+
+			Logger::WriteMessage( L"Barrett reduction ( 512 mod fixed 512 ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, BarrettMod );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, BarrettMod );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, BarrettMod );
+
+			Logger::WriteMessage( L"Barrett reduction ( 1024 mod fixed 512 ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 0 ];
+			RunStats( &No4, BarrettMod1024 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 1 ];
+			RunStats( &No5, BarrettMod1024 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 2 ];
+			RunStats( &No6, BarrettMod1024 );
+		};
+
 		TEST_METHOD( ui512_10_div64 )
 		{
 			u64 seed = 0;
@@ -622,5 +795,249 @@ namespace ui512_Unit_Tests
 			perf_stats No3 = Perf_Test_Parms [ 2 ];
 			RunStats( &No3, Div64 );
 		};
+
+		TEST_METHOD( ui512_12_div64_pre )
+		{
+			u64 seed = 0;
+			div64_ctx ctx;
+			_UI512( dividend ) { 0 };
+			_UI512( quotient ) { 0 };
+			_UI512( expectedquotient ) { 0 };
+			u64 divisor = 0;
+			u64 remainder = 0;
+			u64 expectedremainder = 0;
+
+			// 1. zero divisor is refused
+			s16 retcode = div64_init( &ctx, 0ull );
+			Assert::AreEqual( s16( -1 ), retcode, L"Return code failed zero divisor" );
+
+			// 2. edge and random divisors ( every bit length ), random dividends, against div_uT64
+			const u64 edges [ ] = { 1ull, 2ull, 3ull, 10ull, 10000000000000000000ull, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull };
+			const int edge_count = int( sizeof( edges ) / sizeof( edges [ 0 ] ) );
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				divisor = ( i < edge_count ) ? edges [ i ] : ( RandomU64( &seed ) >> ( i % 64 ) ) | 1ull;
+				retcode = div64_init( &ctx, divisor );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed init on run #" << i ) );
+				RandomFill( dividend, &seed );
+				div_uT64( expectedquotient, &expectedremainder, dividend, divisor );
+				retcode = div_uT64_pre( quotient, &remainder, dividend, &ctx );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedquotient [ j ], quotient [ j ],
+						_MSGW( L"Quotient at word #" << j << " failed divisor " << divisor << " on run #" << i ) );
+				};
+				Assert::AreEqual( expectedremainder, remainder,
+					_MSGW( L"Remainder failed divisor " << divisor << " on run #" << i ) );
+				Assert::AreEqual( expectedremainder, mod_uT64( dividend, &ctx ),
+					_MSGW( L"Mod failed divisor " << divisor << " on run #" << i ) );
+
+				// in place: quotient written over dividend
+				div_uT64_pre( dividend, &remainder, dividend, &ctx );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedquotient [ j ], dividend [ j ],
+						_MSGW( L"In place quotient at word #" << j << " failed divisor " << divisor << " on run #" << i ) );
+				};
+			};
+
+			// 3. use case: extract decimal digits, as in ui512_10_div64, with one reciprocal for ten
+			RandomFill( dividend, &seed );
+			string expected_digits;
+			string digits;
+			copy_u( quotient, dividend );
+			while ( compare_uT64( quotient, 0ull ) != 0 )
+			{
+				div_uT64( quotient, &remainder, quotient, 10ull );
+				expected_digits.insert( expected_digits.begin( ), char( '0' + remainder ) );
+			};
+			div64_init( &ctx, 10ull );
+			copy_u( quotient, dividend );
+			while ( compare_uT64( quotient, 0ull ) != 0 )
+			{
+				div_uT64_pre( quotient, &remainder, quotient, &ctx );
+				digits.insert( digits.begin( ), char( '0' + remainder ) );
+			};
+			Assert::AreEqual( expected_digits, digits );
+
+			string test_message = _MSGA( "Divide by 64 bit divisor with precomputed reciprocal testing. Ran tests " << test_run_count << " times, each with pseudo-random values.\n" );
+			test_message += "Passed. Quotients and remainders verified against div_uT64, in place and not; decimal digits verified; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512_13_div64_pre_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Compare with ui512_11_div64_performance
+
+			Logger::WriteMessage( L"Divide x64 with precomputed reciprocal function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Div64Pre );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Div64Pre );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Div64Pre );
+
+			Logger::WriteMessage( L"Modulo x64 with precomputed reciprocal function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 0 ];
+			RunStats( &No4, Mod64 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 1 ];
+			RunStats( &No5, Mod64 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 2 ];
+			RunStats( &No6, Mod64 );
+		};
+
+		TEST_METHOD( ui512_14_div64_x4 )
+		{
+			// div_uT64_x4 tests, each of the four against div_uT64
+			// Note: div_uT64 must pass testing before these tests
+
+			u64 seed = 0;
+			alignas ( 64 ) u64 dividend [ 4 ] [ 8 ] { };
+			alignas ( 64 ) u64 quotient [ 4 ] [ 8 ] { };
+			alignas ( 64 ) u64 expectedquotient [ 4 ] [ 8 ] { };
+			u64 divisor [ 4 ] = { 0 };
+			u64 remainder [ 4 ] = { 0 };
+			u64 expectedremainder [ 4 ] = { 0 };
+			u64* quotients [ 4 ] = { quotient [ 0 ], quotient [ 1 ], quotient [ 2 ], quotient [ 3 ] };
+			u64* remainders [ 4 ] = { &remainder [ 0 ], &remainder [ 1 ], &remainder [ 2 ], &remainder [ 3 ] };
+			const u64* dividends [ 4 ] = { dividend [ 0 ], dividend [ 1 ], dividend [ 2 ], dividend [ 3 ] };
+
+			// 1. edge and random divisors ( every bit length, differing across the four ), random dividends
+			const u64 edges [ ] = { 1ull, 2ull, 3ull, 10ull, 10000000000000000000ull, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull };
+			const int edge_count = int( sizeof( edges ) / sizeof( edges [ 0 ] ) );
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				for ( int n = 0; n < 4; n++ )
+				{
+					int k = 4 * i + n;
+					divisor [ n ] = ( k < edge_count ) ? edges [ k ] : ( RandomU64( &seed ) >> ( k % 64 ) ) | 1ull;
+					RandomFill( dividend [ n ], &seed );
+					div_uT64( expectedquotient [ n ], &expectedremainder [ n ], dividend [ n ], divisor [ n ] );
+				};
+				s16 retcode = div_uT64_x4( quotients, remainders, dividends, divisor );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed on run #" << i ) );
+				for ( int n = 0; n < 4; n++ )
+				{
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expectedquotient [ n ] [ j ], quotient [ n ] [ j ],
+							_MSGW( L"Quotient #" << n << " at word #" << j << " failed divisor " << divisor [ n ] << " on run #" << i ) );
+					};
+					Assert::AreEqual( expectedremainder [ n ], remainder [ n ],
+						_MSGW( L"Remainder #" << n << " failed divisor " << divisor [ n ] << " on run #" << i ) );
+				};
+			};
+
+			// 2. in place: quotients written over the dividends
+			u64* into_dividends [ 4 ] = { dividend [ 0 ], dividend [ 1 ], dividend [ 2 ], dividend [ 3 ] };
+			div_uT64_x4( into_dividends, remainders, dividends, divisor );
+			for ( int n = 0; n < 4; n++ )
+			{
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedquotient [ n ] [ j ], dividend [ n ] [ j ], _MSGW( L"In place quotient #" << n << " at word #" << j << " failed" ) );
+				};
+			};
+
+			// 3. a zero divisor: that one zeroed, -1 returned, the others still divided
+			for ( int n = 0; n < 4; n++ )
+			{
+				RandomFill( dividend [ n ], &seed );
+				divisor [ n ] = RandomU64( &seed ) | 1ull;
+				div_uT64( expectedquotient [ n ], &expectedremainder [ n ], dividend [ n ], divisor [ n ] );
+			};
+			divisor [ 2 ] = 0;
+			zero_u( expectedquotient [ 2 ] );
+			expectedremainder [ 2 ] = 0;
+			s16 retcode = div_uT64_x4( quotients, remainders, dividends, divisor );
+			Assert::AreEqual( s16( -1 ), retcode, L"Return code failed zero divisor" );
+			for ( int n = 0; n < 4; n++ )
+			{
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedquotient [ n ] [ j ], quotient [ n ] [ j ], _MSGW( L"Quotient #" << n << " at word #" << j << " failed with a zero divisor" ) );
+				};
+				Assert::AreEqual( expectedremainder [ n ], remainder [ n ], _MSGW( L"Remainder #" << n << " failed with a zero divisor" ) );
+			};
+
+			// 4. remainders written over the divisors, each into the next lane's; lane 0 divides by one, so its zero remainder lands
+			// on lane 1's divisor before lane 1 is stored
+			for ( int n = 0; n < 4; n++ )
+			{
+				RandomFill( dividend [ n ], &seed );
+				divisor [ n ] = ( n == 0 ) ? 1ull : RandomU64( &seed ) | 1ull;
+				div_uT64( expectedquotient [ n ], &expectedremainder [ n ], dividend [ n ], divisor [ n ] );
+			};
+			u64* into_divisors [ 4 ] = { &divisor [ 1 ], &divisor [ 2 ], &divisor [ 3 ], &divisor [ 0 ] };
+			retcode = div_uT64_x4( quotients, into_divisors, dividends, divisor );
+			Assert::AreEqual( s16( 0 ), retcode, L"Return code failed remainders over the divisors" );
+			for ( int n = 0; n < 4; n++ )
+			{
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedquotient [ n ] [ j ], quotient [ n ] [ j ], _MSGW( L"Quotient #" << n << " at word #" << j << " failed, remainders over the divisors" ) );
+				};
+				Assert::AreEqual( expectedremainder [ n ], divisor [ ( n + 1 ) & 3 ], _MSGW( L"Remainder #" << n << " failed, remainders over the divisors" ) );
+			};
+
+			string test_message = _MSGA( "Four at a time divide by 64 bit divisor testing. Ran tests " << test_run_count << " times, each with four pseudo-random values.\n" );
+			test_message += "Passed. Quotients and remainders verified against div_uT64, in place and not; zero divisor; remainders over the divisors; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512_15_div64_x4_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Each sample is four divisions: one div_uT64_x4 call, then, for comparison, four div_uT64 calls back to back
+
+			const Perf_Tests tests [ 2 ] = { Div64X4, Div64_4Calls };
+			const wchar_t* titles [ 2 ] = {
+				L"Divide x64, four at a time ( interleaved ), function performance timing test.\n\n",
+				L"Divide x64, four calls back to back, performance timing test, for comparison.\n\n" };
+			double per_division [ 2 ] = { 0 };
+			double per_division_throughput [ 2 ] = { 0 };
+			for ( int t = 0; t < 2; t++ )
+			{
+				Logger::WriteMessage( titles [ t ] );
+
+				Logger::WriteMessage( L"First run.\n" );
+				perf_stats No1 = Perf_Test_Parms [ 0 ];
+				RunStats( &No1, tests [ t ] );
+
+				Logger::WriteMessage( L"Second run.\n" );
+				perf_stats No2 = Perf_Test_Parms [ 1 ];
+				RunStats( &No2, tests [ t ] );
+
+				Logger::WriteMessage( L"Third run.\n" );
+				perf_stats No3 = Perf_Test_Parms [ 2 ];
+				RunStats( &No3, tests [ t ] );
+				per_division [ t ] = No3.mean / 4.0;
+				per_division_throughput [ t ] = No3.throughput_cycles / 4.0;
+			};
+
+			string message = format( "Clock cycles per division ( third runs ): interleaved \t{:6.2f}, back to back \t{:6.2f}\n", per_division [ 0 ], per_division [ 1 ] );
+			message += format( "Throughput, clock cycles per division: interleaved \t{:6.2f}, back to back \t{:6.2f}\n\n", per_division_throughput [ 0 ], per_division_throughput [ 1 ] );
+			Logger::WriteMessage( message.c_str( ) );
+		};
 	};
 };
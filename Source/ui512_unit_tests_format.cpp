@@ -0,0 +1,317 @@
+//		ui512_unit_tests_format
+//
+//		File:			ui512_unit_tests_format.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_format.h"
+#include "ui512_unit_tests.h"
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_format )
+	{
+		// reference: one decimal digit at a time, as in ui512_10_div64
+		static string DecimalByDigit( const u64* value )
+		{
+			_UI512( q ) { 0 };
+			u64 remainder = 0;
+			string digits;
+			copy_u( q, value );
+			do
+			{
+				div_uT64( q, &remainder, q, 10ull );
+				digits.insert( digits.begin( ), char( '0' + remainder ) );
+			} while ( compare_uT64( q, 0ull ) != 0 );
+			return digits;
+		};
+
+		TEST_METHOD( ui512fmt_01_to_decimal )
+		{
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			char buffer [ ui512_decimal_max + 1 ] = { 0 };
+			const string max_decimal = "13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084095";
+
+			// 1. edges: zero, one, 10^19 ( two chunks ), 2^512 - 1 ( longest )
+			zero_u( num1 );
+			Assert::AreEqual( s16( 1 ), to_decimal( buffer, int( sizeof( buffer ) ), num1 ), L"Length failed zero" );
+			Assert::AreEqual( string( "0" ), string( buffer ), L"Text failed zero" );
+
+			set_uT64( num1, 1ull );
+			Assert::AreEqual( s16( 1 ), to_decimal( buffer, int( sizeof( buffer ) ), num1 ), L"Length failed one" );
+			Assert::AreEqual( string( "1" ), string( buffer ), L"Text failed one" );
+
+			set_uT64( num1, 10000000000000000000ull );
+			Assert::AreEqual( s16( 20 ), to_decimal( buffer, int( sizeof( buffer ) ), num1 ), L"Length failed 10^19" );
+			Assert::AreEqual( string( "10000000000000000000" ), string( buffer ), L"Text failed 10^19" );
+
+			std::fill_n( num1, 8, u64_Max );
+			Assert::AreEqual( s16( ui512_decimal_max ), to_decimal( buffer, int( sizeof( buffer ) ), num1 ), L"Length failed 2^512 - 1" );
+			Assert::AreEqual( max_decimal, string( buffer ), L"Text failed 2^512 - 1" );
+
+			// 2. buffer too small is refused, untouched; exact size is enough
+			std::fill_n( buffer, ui512_decimal_max + 1, 'x' );
+			Assert::AreEqual( s16( -1 ), to_decimal( buffer, ui512_decimal_max, num1 ), L"Return code failed short buffer" );
+			Assert::AreEqual( 'x', buffer [ 0 ], L"Short buffer was written" );
+			Assert::AreEqual( s16( ui512_decimal_max ), to_decimal( buffer, ui512_decimal_max + 1, num1 ), L"Length failed exact buffer" );
+
+			// 3. random values of every bit length, against one digit at a time
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( num1, &seed );
+				shr_u( num1, num1, u16( i % 512 ) );
+				string expected = DecimalByDigit( num1 );
+				s16 len = to_decimal( buffer, int( sizeof( buffer ) ), num1 );
+				Assert::AreEqual( s16( expected.length( ) ), len, _MSGW( L"Length failed on run #" << i ) );
+				Assert::AreEqual( expected, string( buffer ), _MSGW( L"Text failed on run #" << i ) );
+			};
+
+			string test_message = _MSGA( "Decimal output function testing. Edge cases, then " << test_run_count << " pseudo-random values of every bit length.\n" );
+			test_message += "Passed. Text and length verified against one digit at a time division; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512fmt_02_from_decimal )
+		{
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( result ) { 0 };
+			char buffer [ ui512_decimal_max + 1 ] = { 0 };
+			const string max_decimal = "13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084095";
+			const string over_decimal = "13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084096";
+
+			// 1. refused: empty, non digits, one over 2^512 - 1
+			Assert::AreEqual( s16( -1 ), from_decimal( result, "", 0 ), L"Return code failed empty text" );
+			Assert::AreEqual( s16( -1 ), from_decimal( result, "12a4", 4 ), L"Return code failed letter" );
+			Assert::AreEqual( s16( -1 ), from_decimal( result, "-1", 2 ), L"Return code failed sign" );
+			Assert::AreEqual( s16( -1 ), from_decimal( result, over_decimal.c_str( ), int( over_decimal.length( ) ) ), L"Return code failed 2^512" );
+
+			// 2. accepted: 2^512 - 1, and leading zeros past the longest value
+			Assert::AreEqual( s16( 0 ), from_decimal( result, max_decimal.c_str( ), int( max_decimal.length( ) ) ), L"Return code failed 2^512 - 1" );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( u64_Max, result [ j ], _MSGW( L"Value at word #" << j << " failed 2^512 - 1" ) );
+			};
+			string padded = string( 40, '0' ) + "10000000000000000000";
+			Assert::AreEqual( s16( 0 ), from_decimal( result, padded.c_str( ), int( padded.length( ) ) ), L"Return code failed leading zeros" );
+			set_uT64( num1, 10000000000000000000ull );
+			Assert::AreEqual( s16( 0 ), compare_u( num1, result ), L"Value failed leading zeros" );
+
+			// 3. round trip, random values of every bit length
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( num1, &seed );
+				shr_u( num1, num1, u16( i % 512 ) );
+				s16 len = to_decimal( buffer, int( sizeof( buffer ) ), num1 );
+				Assert::AreEqual( s16( 0 ), from_decimal( result, buffer, len ), _MSGW( L"Return code failed on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( num1 [ j ], result [ j ], _MSGW( L"Value at word #" << j << " failed round trip on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Decimal input function testing. Refused and edge cases, then " << test_run_count << " pseudo-random round trips.\n" );
+			test_message += "Passed. Return codes and values verified; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512fmt_03_decimal_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Decimal output function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, ToDecimal );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, ToDecimal );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, ToDecimal );
+
+			Logger::WriteMessage( L"Decimal input function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 0 ];
+			RunStats( &No4, FromDecimal );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 1 ];
+			RunStats( &No5, FromDecimal );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 2 ];
+			RunStats( &No6, FromDecimal );
+		};
+
+		TEST_METHOD( ui512fmt_04_to_hex )
+		{
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			char buffer [ ui512_hex_chars + 1 ] = { 0 };
+			char expected [ ui512_hex_chars + 1 ] = { 0 };
+
+			// 1. known value: qword [ i ] = 0x0123456789ABCDE0 + i, [0] printed first
+			for ( int i = 0; i < 8; i++ )
+			{
+				num1 [ i ] = 0x0123456789ABCDE0ull + u64( i );
+			};
+			to_hex( buffer, num1 );
+			string known;
+			for ( int i = 0; i < 8; i++ )
+			{
+				known += "0123456789ABCDE";
+				known += char( '0' + i );
+			};
+			Assert::AreEqual( known, string( buffer ), L"Text failed known value" );
+			Assert::AreEqual( size_t( ui512_hex_chars ), strlen( buffer ), L"Length failed known value" );
+
+			// 2. random values, against snprintf per qword
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( num1, &seed );
+				for ( int j = 0; j < 8; j++ )
+				{
+					snprintf( expected + j * 16, 17, "%016llX", num1 [ j ] );
+				};
+				to_hex( buffer, num1 );
+				Assert::AreEqual( string( expected ), string( buffer ), _MSGW( L"Text failed on run #" << i ) );
+			};
+
+			// 3. message macro: same text
+			Assert::AreEqual( string( buffer ), string( _MtoHexText( num1 ) ), L"Message macro failed" );
+
+			string test_message = _MSGA( "Hex output function testing. Known value, then " << test_run_count << " pseudo-random values.\n" );
+			test_message += "Passed. Text verified against snprintf, most significant qword first; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512fmt_05_from_hex )
+		{
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( result ) { 0 };
+			char buffer [ ui512_hex_chars + 1 ] = { 0 };
+
+			// 1. refused: empty, too long, non hex characters in each position
+			Assert::AreEqual( s16( -1 ), from_hex( result, "", 0 ), L"Return code failed empty text" );
+			string text( ui512_hex_chars + 1, '0' );
+			Assert::AreEqual( s16( -1 ), from_hex( result, text.c_str( ), int( text.length( ) ) ), L"Return code failed long text" );
+			const char bad [ ] = { 'G', 'g', '/', ':', '@', '`', ' ', char( 0xC1 ) };
+			for ( int i = 0; i < ui512_hex_chars; i++ )
+			{
+				text.assign( ui512_hex_chars, 'a' );
+				text [ i ] = bad [ i % sizeof( bad ) ];
+				Assert::AreEqual( s16( -1 ), from_hex( result, text.c_str( ), ui512_hex_chars ),
+					_MSGW( L"Return code failed bad character at position #" << i ) );
+			};
+
+			// 2. short text and mixed case
+			Assert::AreEqual( s16( 0 ), from_hex( result, "aBc", 3 ), L"Return code failed short text" );
+			set_uT64( num1, 0xABCull );
+			Assert::AreEqual( s16( 0 ), compare_u( num1, result ), L"Value failed short text" );
+
+			// 3. round trip, upper and lower case
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( num1, &seed );
+				to_hex( buffer, num1 );
+				if ( i & 1 )
+				{
+					for ( int j = 0; j < ui512_hex_chars; j++ )
+					{
+						buffer [ j ] = char( tolower( buffer [ j ] ) );
+					};
+				};
+				Assert::AreEqual( s16( 0 ), from_hex( result, buffer, ui512_hex_chars ), _MSGW( L"Return code failed on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( num1 [ j ], result [ j ], _MSGW( L"Value at word #" << j << " failed round trip on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Hex input function testing. Refused and edge cases, then " << test_run_count << " pseudo-random round trips.\n" );
+			test_message += "Passed. Return codes and values verified; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512fmt_06_hex_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Hex output function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, ToHex );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, ToHex );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, ToHex );
+
+			Logger::WriteMessage( L"Hex input function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 0 ];
+			RunStats( &No4, FromHex );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 1 ];
+			RunStats( &No5, FromHex );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 2 ];
+			RunStats( &No6, FromHex );
+		};
+	};
+};
@@ -0,0 +1,263 @@
+//		ui512_unit_tests_inline
+//
+//		File:			ui512_unit_tests_inline.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_inline.h"
+#include "ui512_unit_tests.h"
+
+#include <atomic>
+#include <format>
+#include <string>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	/// <summary>
+	/// Average cycles per call of "op" over timing_count calls, after a warm up.
+	/// A compiler-only fence follows each call, so an inlined op can not be merged with its neighbors or hoisted out of the loop.
+	/// </summary>
+	/// <param name="op">operation to time, called with the iteration number</param>
+	/// <returns>average clock cycles per call</returns>
+	template <typename Op> double CyclesPerCall( Op op )
+	{
+		for ( int i = 0; i < timing_count / 100; i++ )
+		{
+			op( i );
+			atomic_signal_fence( memory_order_seq_cst );
+		};
+		u64 start = __rdtsc( );
+		for ( int i = 0; i < timing_count; i++ )
+		{
+			op( i );
+			atomic_signal_fence( memory_order_seq_cst );
+		};
+		return double( __rdtsc( ) - start ) / double( timing_count );
+	};
+
+	TEST_CLASS( ui512_unit_tests_inline )
+	{
+		TEST_METHOD( ui512inl_01_clear_copy_set )
+		{
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( result ) { 0 };
+
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( result, &seed );
+				zero_u_inl( result );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( 0ull, result [ j ], _MSGW( L"zero_u_inl at word #" << j << " failed on run #" << i ) );
+				};
+
+				RandomFill( num1, &seed );
+				copy_u_inl( result, num1 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( num1 [ j ], result [ j ], _MSGW( L"copy_u_inl at word #" << j << " failed on run #" << i ) );
+				};
+
+				u64 val = RandomU64( &seed );
+				RandomFill( result, &seed );
+				set_uT64( expected, val );
+				set_uT64_inl( result, val );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"set_uT64_inl at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = "Inline zero, copy, set function testing. Ran tests " + to_string( test_run_count ) + " times, each with pseudo random values.\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values (against the externs) via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512inl_02_compare )
+		{
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( num2 ) { 0 };
+			_UI512( zero ) { 0 };
+			_UI512( allones );
+			std::fill_n( allones, 8, u64_Max );
+
+			Assert::AreEqual( ( s16 ) 0, compare_u_inl( zero, zero ) );
+			Assert::AreEqual( ( s16 ) 0, compare_u_inl( allones, allones ) );
+			Assert::AreEqual( ( s16 ) 1, compare_u_inl( allones, zero ) );
+			Assert::AreEqual( ( s16 ) -1, compare_u_inl( zero, allones ) );
+			Assert::AreEqual( ( s16 ) -1, compare_uT64_inl( zero, 1 ) );
+			Assert::AreEqual( ( s16 ) 1, compare_uT64_inl( allones, 0 ) );
+			Assert::AreEqual( ( s16 ) 0, compare_uT64_inl( zero, 0 ) );
+
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				// equal, then differing in exactly one word (each word in turn), both directions
+				RandomFill( num1, &seed );
+				copy_u( num2, num1 );
+				Assert::AreEqual( compare_u( num1, num2 ), compare_u_inl( num1, num2 ), _MSGW( L"compare_u_inl equal failed on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					num2 [ j ] = RandomU64( &seed );
+					Assert::AreEqual( compare_u( num1, num2 ), compare_u_inl( num1, num2 ), _MSGW( L"compare_u_inl word #" << j << " failed on run #" << i ) );
+					Assert::AreEqual( compare_u( num2, num1 ), compare_u_inl( num2, num1 ), _MSGW( L"compare_u_inl (reversed) word #" << j << " failed on run #" << i ) );
+					num2 [ j ] = num1 [ j ];
+				};
+
+				// 64 bit compare, against values that fit, and values that don't
+				u64 val = RandomU64( &seed );
+				shr_u( num2, num1, u16( RandomU64( &seed ) % 512 ) );
+				Assert::AreEqual( compare_uT64( num2, val ), compare_uT64_inl( num2, val ), _MSGW( L"compare_uT64_inl failed on run #" << i ) );
+				set_uT64( num2, val );
+				Assert::AreEqual( compare_uT64( num2, val ), compare_uT64_inl( num2, val ), _MSGW( L"compare_uT64_inl (equal) failed on run #" << i ) );
+				Assert::AreEqual( compare_uT64( num2, val + 1 ), compare_uT64_inl( num2, val + 1 ), _MSGW( L"compare_uT64_inl (plus one) failed on run #" << i ) );
+			};
+
+			string test_message = "Inline compare function testing. Edge cases, then ran tests " + to_string( test_run_count ) + " times, each with pseudo random values.\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values (against the externs) via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512inl_03_bitops )
+		{
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( num2 ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( result ) { 0 };
+
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( num1, &seed );
+				RandomFill( num2, &seed );
+
+				and_u( expected, num1, num2 );
+				and_u_inl( result, num1, num2 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"and_u_inl at word #" << j << " failed on run #" << i ) );
+				};
+
+				or_u( expected, num1, num2 );
+				or_u_inl( result, num1, num2 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"or_u_inl at word #" << j << " failed on run #" << i ) );
+				};
+
+				xor_u( expected, num1, num2 );
+				xor_u_inl( result, num1, num2 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"xor_u_inl at word #" << j << " failed on run #" << i ) );
+				};
+
+				not_u( expected, num1 );
+				not_u_inl( result, num1 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"not_u_inl at word #" << j << " failed on run #" << i ) );
+				};
+
+				// in place (destination is also a source)
+				copy_u( result, num1 );
+				xor_u_inl( result, result, num2 );
+				xor_u( expected, num1, num2 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"xor_u_inl in place at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = "Inline AND, OR, XOR, NOT function testing. Ran tests " + to_string( test_run_count ) + " times, each with pseudo random values.\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values (against the externs) via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512inl_04_inline_vs_extern_performance )
+		{
+			// Side by side timing: the same loop body, once calling the extern, once the inline version.
+			// Note: these tests are not pass/fail, they are informational only
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( num2 ) { 0 };
+			_UI512( result ) { 0 };
+			RandomFill( num1, &seed );
+			RandomFill( num2, &seed );
+			s16 rc = 0;
+
+			string test_message = format( "Inline vs. extern (out-of-line) timing. {:d} calls each, average clock cycles per call.\n\n", timing_count );
+			test_message += " Function      |   Extern   |   Inline   | Extern / Inline |\n";
+			test_message += "---------------|------------|------------|-----------------|\n";
+			auto report = [ & ] ( const char* name, double ext, double inl )
+				{
+					test_message += format( " {:13s} | {:10.2f} | {:10.2f} | {:15.2f} |\n", name, ext, inl, ( inl > 0.0 ) ? ext / inl : 0.0 );
+				};
+
+			report( "zero_u",
+				CyclesPerCall( [ & ] ( int i ) { zero_u( result ); } ),
+				CyclesPerCall( [ & ] ( int i ) { zero_u_inl( result ); } ) );
+			report( "copy_u",
+				CyclesPerCall( [ & ] ( int i ) { copy_u( result, num1 ); } ),
+				CyclesPerCall( [ & ] ( int i ) { copy_u_inl( result, num1 ); } ) );
+			report( "set_uT64",
+				CyclesPerCall( [ & ] ( int i ) { set_uT64( result, u64( i ) ); } ),
+				CyclesPerCall( [ & ] ( int i ) { set_uT64_inl( result, u64( i ) ); } ) );
+			report( "compare_u",
+				CyclesPerCall( [ & ] ( int i ) { num2 [ i & 7 ] ^= u64( i ); rc += compare_u( num1, num2 ); } ),
+				CyclesPerCall( [ & ] ( int i ) { num2 [ i & 7 ] ^= u64( i ); rc += compare_u_inl( num1, num2 ); } ) );
+			report( "compare_uT64",
+				CyclesPerCall( [ & ] ( int i ) { rc += compare_uT64( num1, u64( i ) ); } ),
+				CyclesPerCall( [ & ] ( int i ) { rc += compare_uT64_inl( num1, u64( i ) ); } ) );
+			report( "and_u",
+				CyclesPerCall( [ & ] ( int i ) { and_u( result, num1, num2 ); } ),
+				CyclesPerCall( [ & ] ( int i ) { and_u_inl( result, num1, num2 ); } ) );
+			report( "or_u",
+				CyclesPerCall( [ & ] ( int i ) { or_u( result, num1, num2 ); } ),
+				CyclesPerCall( [ & ] ( int i ) { or_u_inl( result, num1, num2 ); } ) );
+			report( "xor_u",
+				CyclesPerCall( [ & ] ( int i ) { xor_u( result, result, num2 ); } ),
+				CyclesPerCall( [ & ] ( int i ) { xor_u_inl( result, result, num2 ); } ) );
+			report( "not_u",
+				CyclesPerCall( [ & ] ( int i ) { not_u( result, result ); } ),
+				CyclesPerCall( [ & ] ( int i ) { not_u_inl( result, result ); } ) );
+
+			test_message += format( "\n(compare results sum: {:d})\n\n", rc );
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+	};	// test_class
+};	// namespace
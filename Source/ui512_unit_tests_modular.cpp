@@ -0,0 +1,691 @@
+//		ui512_unit_tests_modular
+//
+//		File:			ui512_unit_tests_modular.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_barrett.h"
+#include "ui512_modular.h"
+#include "ui512_montgomery.h"
+#include "ui512_unit_tests.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_modular )
+	{
+		// reference: right to left square and multiply, each product reduced by Barrett ( no Montgomery )
+		static void PowModReference( u64* result, const u64* base, const u64* exp, const u64* modulus )
+		{
+			barrett_ctx bctx;
+			_UI512( b ) { 0 };
+			_UI512( lo ) { 0 };
+			_UI512( hi ) { 0 };
+			barrett_init( &bctx, modulus );
+			barrett_mod( b, base, &bctx );
+			set_uT64( lo, 1ull );
+			barrett_mod( result, lo, &bctx );
+			for ( int i = 0; i < 512; i++ )
+			{
+				if ( ( exp [ 7 - ( i / 64 ) ] >> ( i % 64 ) ) & 1ull )
+				{
+					mult_u( lo, hi, result, b );
+					barrett_mod_1024( result, lo, hi, &bctx );
+				};
+				mult_u( lo, hi, b, b );
+				barrett_mod_1024( b, lo, hi, &bctx );
+			};
+		};
+
+		// reference: Euclid, one div_u per step
+		static void GcdReference( u64* result, const u64* a, const u64* b )
+		{
+			_UI512( x ) { 0 };
+			_UI512( y ) { 0 };
+			_UI512( q ) { 0 };
+			_UI512( r ) { 0 };
+			copy_u( x, a );
+			copy_u( y, b );
+			while ( compare_uT64( y, 0ull ) != 0 )
+			{
+				div_u( q, r, x, y );
+				copy_u( x, y );
+				copy_u( y, r );
+			};
+			copy_u( result, x );
+		};
+
+		TEST_METHOD( ui512mod_01_powmod )
+		{
+			u64 seed = 0;
+			_UI512( base ) { 0 };
+			_UI512( exp ) { 0 };
+			_UI512( modulus ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( allones );
+			std::fill_n( allones, 8, u64_Max );
+
+			// 1. refused: even modulus, zero modulus, window out of range
+			set_uT64( modulus, 10ull );
+			Assert::AreEqual( s16( -1 ), powmod_u( result, base, exp, modulus ), L"Return code failed even modulus" );
+			zero_u( modulus );
+			Assert::AreEqual( s16( -1 ), powmod_u( result, base, exp, modulus ), L"Return code failed zero modulus" );
+			set_uT64( modulus, 7ull );
+			Assert::AreEqual( s16( -1 ), powmod_u( result, base, exp, modulus, powmod_window, powmod_window_max + 1 ), L"Return code failed window" );
+
+			// 2. small known values, both modes: 3^5 mod 7 = 5; x^0 = 1; anything mod 1 = 0
+			for ( int mode = powmod_window; mode <= powmod_ladder; mode++ )
+			{
+				set_uT64( base, 3ull );
+				set_uT64( exp, 5ull );
+				set_uT64( modulus, 7ull );
+				Assert::AreEqual( s16( 0 ), powmod_u( result, base, exp, modulus, powmod_mode( mode ) ), _MSGW( L"Return code failed 3^5 mod 7, mode " << mode ) );
+				Assert::AreEqual( 0, compare_uT64( result, 5ull ), _MSGW( L"Result failed 3^5 mod 7, mode " << mode ) );
+
+				zero_u( exp );
+				powmod_u( result, base, exp, modulus, powmod_mode( mode ) );
+				Assert::AreEqual( 0, compare_uT64( result, 1ull ), _MSGW( L"Result failed x^0, mode " << mode ) );
+
+				set_uT64( modulus, 1ull );
+				set_uT64( exp, 5ull );
+				powmod_u( result, base, exp, modulus, powmod_mode( mode ) );
+				Assert::AreEqual( 0, compare_uT64( result, 0ull ), _MSGW( L"Result failed mod 1, mode " << mode ) );
+			};
+
+			// 3. Fermat: a^( p - 1 ) mod p = 1, for primes 2^127 - 1, 2^255 - 19, 2^521 would not fit, so also 2^61 - 1
+			{
+				_UI512( primes [ 3 ] ) { 0 };
+				zero_u( primes [ 0 ] );
+				primes [ 0 ] [ 7 ] = 0x1FFFFFFFFFFFFFFFull;							// 2^61 - 1
+				zero_u( primes [ 1 ] );
+				primes [ 1 ] [ 6 ] = 0x7FFFFFFFFFFFFFFFull;
+				primes [ 1 ] [ 7 ] = u64_Max;										// 2^127 - 1
+				zero_u( primes [ 2 ] );
+				primes [ 2 ] [ 4 ] = 0x7FFFFFFFFFFFFFFFull;
+				primes [ 2 ] [ 5 ] = u64_Max;
+				primes [ 2 ] [ 6 ] = u64_Max;
+				primes [ 2 ] [ 7 ] = u64_Max - 18;									// 2^255 - 19
+				for ( int p = 0; p < 3; p++ )
+				{
+					for ( int i = 0; i < test_run_count / 10; i++ )
+					{
+						RandomFill( base, &seed );
+						div_u( expected, base, base, primes [ p ] );				// base mod p
+						base [ 7 ] |= ( compare_uT64( base, 0ull ) == 0 ) ? 1ull : 0ull;
+						sub_uT64( exp, primes [ p ], 1ull );
+						for ( int mode = powmod_window; mode <= powmod_ladder; mode++ )
+						{
+							powmod_u( result, base, exp, primes [ p ], powmod_mode( mode ) );
+							Assert::AreEqual( 0, compare_uT64( result, 1ull ), _MSGW( L"Fermat failed prime #" << p << " mode " << mode << " on run #" << i ) );
+						};
+					};
+				};
+			};
+
+			// 4. random odd moduli of every length ( including 2^512 - 1 ), random bases and exponents, every window, against the reference
+			for ( int i = 0; i < test_run_count / 10; i++ )
+			{
+				RandomFill( modulus, &seed );
+				shr_u( modulus, modulus, u16( i % 500 ) );
+				modulus [ 7 ] |= 1ull;
+				if ( i == 0 )
+				{
+					copy_u( modulus, allones );
+				};
+				RandomFill( base, &seed );
+				RandomFill( exp, &seed );
+				shr_u( exp, exp, u16( ( i * 7 ) % 512 ) );
+				PowModReference( expected, base, exp, modulus );
+
+				for ( int window = 0; window <= powmod_window_max; window++ )
+				{
+					s16 retcode = powmod_u( result, base, exp, modulus, powmod_window, window );
+					Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed window " << window << " on run #" << i ) );
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed window " << window << " on run #" << i ) );
+					};
+				};
+				powmod_u( result, base, exp, modulus, powmod_ladder );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed ladder on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Modular exponentiation function testing. Refused and small cases; Fermat's little theorem for three primes, "
+				<< test_run_count / 10 << " times each; " << test_run_count / 10 << " pseudo-random moduli, bases and exponents, every window.\n" );
+			test_message += "Passed. Sliding window and ladder results verified against square and multiply with Barrett reduction; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512mod_02_powmod_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Each sample is a full 512 bit exponent: hundreds of Montgomery multiplies. Sample counts are cut by 100 from the usual runs
+
+			Logger::WriteMessage( L"Modular exponentiation ( sliding window ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			No1.timing_count /= 100;
+			ui512_Unit_Tests::RunStats( &No1, PowModWindow );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			No2.timing_count /= 100;
+			RunStats( &No2, PowModWindow );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			No3.timing_count /= 100;
+			RunStats( &No3, PowModWindow );
+
+			Logger::WriteMessage( L"Modular exponentiation ( Montgomery ladder ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 0 ];
+			No4.timing_count /= 100;
+			RunStats( &No4, PowModLadder );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 1 ];
+			No5.timing_count /= 100;
+			RunStats( &No5, PowModLadder );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 2 ];
+			No6.timing_count /= 100;
+			RunStats( &No6, PowModLadder );
+		};
+
+		TEST_METHOD( ui512mod_03_modinv )
+		{
+			u64 seed = 0;
+			_UI512( a ) { 0 };
+			_UI512( modulus ) { 0 };
+			_UI512( inverse ) { 0 };
+			_UI512( inverse_var ) { 0 };
+			_UI512( lo ) { 0 };
+			_UI512( hi ) { 0 };
+			_UI512( q ) { 0 };
+			_UI512( r ) { 0 };
+			typedef s16( *inv_fn )( u64*, const u64*, const u64* );
+			const inv_fn fns [ 2 ] = { modinv_u, modinv_u_var };
+			const char* names [ 2 ] = { "modinv_u", "modinv_u_var" };
+
+			for ( int f = 0; f < 2; f++ )
+			{
+				// 1. refused: even modulus, zero modulus, no inverse ( zero, the modulus itself, a shared factor )
+				set_uT64( modulus, 10ull );
+				set_uT64( a, 3ull );
+				Assert::AreEqual( s16( -1 ), fns [ f ]( inverse, a, modulus ), _MSGW( names [ f ] << L" return code failed even modulus" ) );
+				zero_u( modulus );
+				Assert::AreEqual( s16( -1 ), fns [ f ]( inverse, a, modulus ), _MSGW( names [ f ] << L" return code failed zero modulus" ) );
+				RandomFill( modulus, &seed );
+				shr_u( modulus, modulus, 2 );
+				modulus [ 7 ] |= 1ull;
+				u64 overflow = 0;
+				mult_uT64( modulus, &overflow, modulus, 3ull );			// modulus = 3 * odd
+				zero_u( a );
+				Assert::AreEqual( s16( -1 ), fns [ f ]( inverse, a, modulus ), _MSGW( names [ f ] << L" return code failed zero" ) );
+				Assert::AreEqual( s16( -1 ), fns [ f ]( inverse, modulus, modulus ), _MSGW( names [ f ] << L" return code failed a = modulus" ) );
+				set_uT64( a, 0x123456789ull * 3 );
+				Assert::AreEqual( s16( -1 ), fns [ f ]( inverse, a, modulus ), _MSGW( names [ f ] << L" return code failed shared factor" ) );
+
+				// 2. small known values: 3^-1 mod 7 = 5; anything mod 1 is 0; ( modulus + 1 )^-1 = 1
+				set_uT64( a, 3ull );
+				set_uT64( modulus, 7ull );
+				Assert::AreEqual( s16( 0 ), fns [ f ]( inverse, a, modulus ), _MSGW( names [ f ] << L" return code failed 3 mod 7" ) );
+				Assert::AreEqual( 0, compare_uT64( inverse, 5ull ), _MSGW( names [ f ] << L" result failed 3 mod 7" ) );
+				set_uT64( modulus, 1ull );
+				Assert::AreEqual( s16( 0 ), fns [ f ]( inverse, a, modulus ), _MSGW( names [ f ] << L" return code failed mod 1" ) );
+				Assert::AreEqual( 0, compare_uT64( inverse, 0ull ), _MSGW( names [ f ] << L" result failed mod 1" ) );
+				std::fill_n( modulus, 8, u64_Max );
+				modulus [ 0 ] = 0x7FFFFFFFFFFFFFFFull;
+				add_uT64( a, modulus, 1ull );
+				fns [ f ]( inverse, a, modulus );
+				Assert::AreEqual( 0, compare_uT64( inverse, 1ull ), _MSGW( names [ f ] << L" result failed modulus + 1" ) );
+			};
+
+			// 3. moduli under 2^256, a under the modulus: the product fits 512 bits, so checked by mult_u, div_u: a * inverse mod modulus = 1
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( modulus, &seed );
+				shr_u( modulus, modulus, u16( 256 + i % 250 ) );
+				modulus [ 7 ] |= 1ull;
+				RandomFill( a, &seed );
+				div_u( q, a, a, modulus );
+				s16 rc = modinv_u( inverse, a, modulus );
+				s16 rc_var = modinv_u_var( inverse_var, a, modulus );
+				Assert::AreEqual( rc, rc_var, _MSGW( L"Return codes differ on run #" << i ) );
+				if ( rc != 0 )
+				{
+					continue;											// no inverse: shares a factor, checked by section 1
+				};
+				Assert::IsTrue( compare_u( inverse, modulus ) < 0, _MSGW( L"Result not reduced on run #" << i ) );
+				mult_u( lo, hi, a, inverse );
+				Assert::AreEqual( 0, compare_uT64( hi, 0ull ), _MSGW( L"Product overflow on run #" << i ) );
+				div_u( q, r, lo, modulus );
+				Assert::AreEqual( 0, compare_uT64( r, 1ull ), _MSGW( L"Round trip failed on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( inverse [ j ], inverse_var [ j ], _MSGW( L"Variable time result at word #" << j << " differs on run #" << i ) );
+				};
+			};
+
+			// 4. moduli of every length to 512 bits ( including 2^512 - 1 ), a any value: a * inverse mod modulus = 1, reduced by Barrett
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( modulus, &seed );
+				shr_u( modulus, modulus, u16( i % 256 ) );
+				modulus [ 7 ] |= 1ull;
+				if ( i == 0 )
+				{
+					std::fill_n( modulus, 8, u64_Max );
+				};
+				RandomFill( a, &seed );
+				s16 rc = modinv_u( inverse, a, modulus );
+				s16 rc_var = modinv_u_var( inverse_var, a, modulus );
+				Assert::AreEqual( rc, rc_var, _MSGW( L"Return codes differ on run #" << i ) );
+				if ( rc != 0 )
+				{
+					continue;
+				};
+				barrett_ctx bctx;
+				barrett_init( &bctx, modulus );
+				mult_u( lo, hi, a, inverse );
+				barrett_mod_1024( r, lo, hi, &bctx );
+				Assert::AreEqual( 0, compare_uT64( r, 1ull ), _MSGW( L"Round trip failed on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( inverse [ j ], inverse_var [ j ], _MSGW( L"Variable time result at word #" << j << " differs on run #" << i ) );
+				};
+			};
+
+			// 5. prime modulus 2^255 - 19: against Fermat, a^( p - 2 )
+			_UI512( p ) { 0 };
+			_UI512( exp ) { 0 };
+			_UI512( fermat ) { 0 };
+			p [ 4 ] = 0x7FFFFFFFFFFFFFFFull;
+			p [ 5 ] = u64_Max;
+			p [ 6 ] = u64_Max;
+			p [ 7 ] = u64_Max - 18;
+			sub_uT64( exp, p, 2ull );
+			for ( int i = 0; i < test_run_count / 10; i++ )
+			{
+				RandomFill( a, &seed );
+				div_u( q, a, a, p );
+				if ( compare_uT64( a, 0ull ) == 0 )
+				{
+					continue;
+				};
+				powmod_u( fermat, a, exp, p );
+				modinv_u( inverse, a, p );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( fermat [ j ], inverse [ j ], _MSGW( L"Result at word #" << j << " differs from Fermat on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Modular inverse function testing. Refused and small cases; " << test_run_count
+				<< " pseudo-random values under 2^256 checked by mult_u, div_u; " << test_run_count << " to 512 bits checked by mult_u, Barrett; "
+				<< test_run_count / 10 << " against Fermat exponentiation.\n" );
+			test_message += "Passed. Constant and variable time results identical; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512mod_04_modinv_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Sample counts are cut by 10 from the usual runs
+
+			Logger::WriteMessage( L"Modular inverse ( constant time ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			No1.timing_count /= 10;
+			ui512_Unit_Tests::RunStats( &No1, ModInv );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			No2.timing_count /= 10;
+			RunStats( &No2, ModInv );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			No3.timing_count /= 10;
+			RunStats( &No3, ModInv );
+
+			Logger::WriteMessage( L"Modular inverse ( variable time ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 0 ];
+			No4.timing_count /= 10;
+			RunStats( &No4, ModInvVar );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 1 ];
+			No5.timing_count /= 10;
+			RunStats( &No5, ModInvVar );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 2 ];
+			No6.timing_count /= 10;
+			RunStats( &No6, ModInvVar );
+		};
+
+		TEST_METHOD( ui512mod_05_batch_modinv )
+		{
+			u64 seed = 0;
+			const int max_n = 300;
+			alignas ( 64 ) static u64 in [ max_n ] [ 8 ];
+			alignas ( 64 ) static u64 out [ max_n ] [ 8 ];
+			alignas ( 64 ) static u64 scratch [ max_n ] [ 8 ];
+			alignas ( 64 ) static u64 copy [ max_n ] [ 8 ];
+			_UI512( modulus ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( factor ) { 0 };
+			u64 overflow = 0;
+
+			// 1. refused: even modulus; nothing to do for n zero
+			set_uT64( modulus, 10ull );
+			Assert::AreEqual( -1, batch_modinv_u( out [ 0 ], in [ 0 ], 1, modulus ), L"Return code failed even modulus" );
+			set_uT64( modulus, 7ull );
+			Assert::AreEqual( 0, batch_modinv_u( out [ 0 ], in [ 0 ], 0, modulus ), L"Return code failed n zero" );
+
+			// 2. random sizes and moduli; some values zero, multiples of the modulus, or ( for a modulus with a factor of 3 ) multiples of 3.
+			// Each result against modinv_u; by turns with a scratch buffer, in place, and without scratch ( run % 3 ), each with a prime
+			// like and a composite modulus ( ( run / 3 ) % 2 ), so the shared factor retry runs in every mode
+			for ( int run = 0; run < 60; run++ )
+			{
+				int n = ( run < 4 ) ? run + 1 : int( RandomU64( &seed ) % max_n ) + 1;
+				bool composite = ( ( run / 3 ) % 2 ) == 1;
+				RandomFill( modulus, &seed );
+				shr_u( modulus, modulus, u16( 2 + run * 8 ) );
+				modulus [ 7 ] |= 1ull;
+				if ( composite )
+				{
+					mult_uT64( modulus, &overflow, modulus, 3ull );
+				};
+				int planted = 0;
+				for ( int i = 0; i < n; i++ )
+				{
+					RandomFill( in [ i ], &seed );
+					u64 pick = RandomU64( &seed ) % 16;
+					if ( pick == 0 )
+					{
+						zero_u( in [ i ] );
+						planted++;
+					}
+					else if ( pick == 1 )
+					{
+						copy_u( in [ i ], modulus );
+						planted++;
+					}
+					else if ( pick == 2 && composite )
+					{
+						shr_u( in [ i ], in [ i ], 4 );
+						mult_uT64( in [ i ], &overflow, in [ i ], 3ull );
+						planted++;
+					};
+					copy_u( copy [ i ], in [ i ] );
+				};
+
+				int bad = 0;
+				int mode = run % 3;
+				if ( mode == 0 )
+				{
+					bad = batch_modinv_u( out [ 0 ], in [ 0 ], n, modulus, scratch [ 0 ] );
+				}
+				else if ( mode == 1 )
+				{
+					bad = batch_modinv_u( in [ 0 ], in [ 0 ], n, modulus, scratch [ 0 ] );
+					for ( int i = 0; i < n; i++ )
+					{
+						copy_u( out [ i ], in [ i ] );
+					};
+				}
+				else
+				{
+					bad = batch_modinv_u( out [ 0 ], in [ 0 ], n, modulus );
+				};
+
+				int expected_bad = 0;
+				for ( int i = 0; i < n; i++ )
+				{
+					if ( modinv_u( expected, copy [ i ], modulus ) != 0 )
+					{
+						zero_u( expected );
+						expected_bad++;
+					};
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expected [ j ], out [ i ] [ j ], _MSGW( L"Result #" << i << " at word #" << j << " failed on run #" << run << " ( n " << n << ", mode " << mode << " )" ) );
+					};
+				};
+				Assert::AreEqual( expected_bad, bad, _MSGW( L"Count of values with no inverse failed on run #" << run ) );
+				Assert::IsTrue( bad >= planted, _MSGW( L"Planted values not all reported on run #" << run ) );
+			};
+
+			string test_message = "Batch modular inverse function testing. 60 pseudo-random batches of up to 300 values, with zero, modulus and shared factor values planted;\n";
+			test_message += "with scratch, in place and without scratch. Passed. Each result verified against modinv_u, and the count of values with no inverse; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512mod_06_batch_modinv_performance )
+		{
+			// Performance timing, per element, by batch size. Not pass/fail, informational only.
+			// Each size is run until about 2^16 values have been inverted ( at least 16 times ); the best ( least disturbed ) run is reported,
+			// next to a single constant time modinv_u on the same modulus. The Montgomery context is set up once, and timed on its own.
+
+			const int max_n = 4096;
+			alignas ( 64 ) static u64 in [ max_n ] [ 8 ];
+			alignas ( 64 ) static u64 out [ max_n ] [ 8 ];
+			alignas ( 64 ) static u64 scratch [ max_n ] [ 8 ];
+			_UI512( modulus ) { 0 };
+			u64 seed = 0;
+			RandomFill( modulus, &seed );
+			modulus [ 0 ] |= 0x8000000000000000ull;
+			modulus [ 7 ] |= 1ull;
+			for ( int i = 0; i < max_n; i++ )
+			{
+				RandomFill( in [ i ], &seed );
+			};
+
+			mont_ctx ctx;
+			u64 start = __rdtsc( );
+			mont_init( &ctx, modulus );
+			u64 setup = __rdtsc( ) - start;
+
+			u64 single = u64_Max;
+			for ( int r = 0; r < 64; r++ )
+			{
+				start = __rdtsc( );
+				modinv_u( out [ 0 ], in [ r ], modulus );
+				u64 cycles = __rdtsc( ) - start;
+				single = ( cycles < single ) ? cycles : single;
+			};
+
+			string test_message = _MSGA( "Batch modular inverse performance timing test, 512 bit modulus. Single modinv_u: " << single
+				<< " clock cycles; Montgomery context set up ( once per modulus, not included below ): " << setup << " clock cycles.\n" );
+			test_message += "n\tcycles per element\tfraction of single\n";
+			for ( int n = 1; n <= max_n; n *= 2 )
+			{
+				int reps = ( 65536 / n > 16 ) ? 65536 / n : 16;
+				u64 best = u64_Max;
+				for ( int r = 0; r < reps; r++ )
+				{
+					start = __rdtsc( );
+					mont_batch_inv( out [ 0 ], in [ 0 ], n, &ctx, scratch [ 0 ] );
+					u64 cycles = __rdtsc( ) - start;
+					best = ( cycles < best ) ? cycles : best;
+				};
+				test_message += _MSGA( n << "\t" << best / u64( n ) << "\t\t\t" << double( best ) / double( n ) / double( single ) << "\n" );
+			};
+			test_message += "\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512mod_07_gcd )
+		{
+			u64 seed = 0;
+			_UI512( a ) { 0 };
+			_UI512( b ) { 0 };
+			_UI512( g ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( result_l ) { 0 };
+			u64 overflow = 0;
+			typedef s16( *gcd_fn )( u64*, const u64*, const u64* );
+			const gcd_fn fns [ 2 ] = { gcd_u, gcd_u_lehmer };
+			const char* names [ 2 ] = { "gcd_u", "gcd_u_lehmer" };
+
+			// 1. zeros, equal values, one, powers of two, small known values
+			for ( int f = 0; f < 2; f++ )
+			{
+				zero_u( a );
+				zero_u( b );
+				fns [ f ]( result, a, b );
+				Assert::AreEqual( 0, compare_uT64( result, 0ull ), _MSGW( names [ f ] << L" failed gcd( 0, 0 )" ) );
+				RandomFill( a, &seed );
+				fns [ f ]( result, a, b );
+				Assert::AreEqual( 0, compare_u( result, a ), _MSGW( names [ f ] << L" failed gcd( a, 0 )" ) );
+				fns [ f ]( result, b, a );
+				Assert::AreEqual( 0, compare_u( result, a ), _MSGW( names [ f ] << L" failed gcd( 0, b )" ) );
+				fns [ f ]( result, a, a );
+				Assert::AreEqual( 0, compare_u( result, a ), _MSGW( names [ f ] << L" failed gcd( a, a )" ) );
+				set_uT64( b, 1ull );
+				fns [ f ]( result, a, b );
+				Assert::AreEqual( 0, compare_uT64( result, 1ull ), _MSGW( names [ f ] << L" failed gcd( a, 1 )" ) );
+				zero_u( a );
+				a [ 0 ] = 0x8000000000000000ull;
+				set_uT64( b, 0x30ull );
+				fns [ f ]( result, a, b );
+				Assert::AreEqual( 0, compare_uT64( result, 0x10ull ), _MSGW( names [ f ] << L" failed gcd( 2^511, 48 )" ) );
+				set_uT64( a, 1071ull );
+				set_uT64( b, 462ull );
+				fns [ f ]( result, a, b );
+				Assert::AreEqual( 0, compare_uT64( result, 21ull ), _MSGW( names [ f ] << L" failed gcd( 1071, 462 )" ) );
+			};
+
+			// 2. planted common factors: a = g * x, b = g * y, g of 1 to 64 bits ( even, at times ); result a multiple of g, and equal to Euclid's
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				u64 factor = RandomU64( &seed ) >> ( i % 64 );
+				factor = ( factor == 0 ) ? 1 : factor;
+				RandomFill( a, &seed );
+				RandomFill( b, &seed );
+				shr_u( a, a, 64 );
+				shr_u( b, b, u16( 64 + ( i % 400 ) ) );
+				mult_uT64( a, &overflow, a, factor );
+				mult_uT64( b, &overflow, b, factor );
+				GcdReference( expected, a, b );
+				gcd_u( result, a, b );
+				gcd_u_lehmer( result_l, a, b );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Binary result at word #" << j << " failed on run #" << i ) );
+					Assert::AreEqual( expected [ j ], result_l [ j ], _MSGW( L"Lehmer result at word #" << j << " failed on run #" << i ) );
+				};
+				u64 rem = 0;
+				div_uT64( g, &rem, result, factor );
+				Assert::AreEqual( 0ull, rem, _MSGW( L"Result not a multiple of the planted factor on run #" << i ) );
+			};
+
+			// 3. consecutive Fibonacci numbers ( the worst case for Euclid, all quotients one ): gcd one
+			zero_u( a );
+			set_uT64( b, 1ull );
+			while ( true )
+			{
+				if ( add_u( g, a, b ) != 0 )
+				{
+					break;
+				};
+				copy_u( a, b );
+				copy_u( b, g );
+			};
+			gcd_u( result, a, b );
+			gcd_u_lehmer( result_l, b, a );
+			Assert::AreEqual( 0, compare_uT64( result, 1ull ), L"Binary failed Fibonacci" );
+			Assert::AreEqual( 0, compare_uT64( result_l, 1ull ), L"Lehmer failed Fibonacci" );
+
+			string test_message = _MSGA( "GCD function testing. Zero, equal, one, power of two and known values; " << test_run_count
+				<< " pseudo-random pairs with planted common factors, of differing lengths; consecutive Fibonacci numbers.\n" );
+			test_message += "Passed. Binary and Lehmer results verified against Euclid ( div_u ); each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512mod_08_gcd_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Sample counts are cut by 10 from the usual runs ( by 100 for Euclid: hundreds of div_u per sample )
+
+			const Perf_Tests tests [ 3 ] = { GcdBinary, GcdLehmer, GcdEuclid };
+			const u32 cuts [ 3 ] = { 10, 10, 100 };
+			const wchar_t* titles [ 3 ] = {
+				L"GCD ( binary ) function performance timing test.\n\n",
+				L"GCD ( Lehmer ) function performance timing test.\n\n",
+				L"GCD ( Euclid, by div_u ) performance timing test, for comparison.\n\n" };
+			for ( int t = 0; t < 3; t++ )
+			{
+				Logger::WriteMessage( titles [ t ] );
+
+				Logger::WriteMessage( L"First run.\n" );
+				perf_stats No1 = Perf_Test_Parms [ 0 ];
+				No1.timing_count /= cuts [ t ];
+				RunStats( &No1, tests [ t ] );
+
+				Logger::WriteMessage( L"Second run.\n" );
+				perf_stats No2 = Perf_Test_Parms [ 1 ];
+				No2.timing_count /= cuts [ t ];
+				RunStats( &No2, tests [ t ] );
+
+				Logger::WriteMessage( L"Third run.\n" );
+				perf_stats No3 = Perf_Test_Parms [ 2 ];
+				No3.timing_count /= cuts [ t ];
+				RunStats( &No3, tests [ t ] );
+			};
+		};
+	};
+};
@@ -0,0 +1,287 @@
+//		ui512_unit_tests_montgomery
+//
+//		File:			ui512_unit_tests_montgomery.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_montgomery.h"
+#include "ui512_unit_tests.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_montgomery )
+	{
+		TEST_METHOD( ui512mont_01_init )
+		{
+			// Context set up: even moduli rejected; for odd moduli, N * N' = -1 mod R, and one (R mod N) converts back to one
+			u64 seed = 0;
+			mont_ctx ctx;
+			_UI512( modulus ) { 0 };
+			_UI512( product ) { 0 };
+			_UI512( overflow ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( allones );
+			std::fill_n( allones, 8, u64_Max );
+
+			zero_u( modulus );
+			Assert::AreEqual( s16( -1 ), mont_init( &ctx, modulus ), L"Return code failed zero modulus test." );
+
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( modulus, &seed );
+				modulus [ 7 ] &= ~1ull;
+				Assert::AreEqual( s16( -1 ), mont_init( &ctx, modulus ), _MSGW( L"Return code failed even modulus test on run #" << i ) );
+
+				modulus [ 7 ] |= 1ull;
+				Assert::AreEqual( s16( 0 ), mont_init( &ctx, modulus ), _MSGW( L"Return code failed odd modulus test on run #" << i ) );
+
+				mult_u( product, overflow, ctx.modulus, ctx.n_prime );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( allones [ j ], product [ j ], _MSGW( L"N * N' at word #" << j << " failed on run #" << i ) );
+				};
+
+				from_mont( result, ctx.r_mod_n, &ctx );
+				Assert::AreEqual( s16( 0 ), compare_uT64( result, 1ull ), _MSGW( L"Montgomery one failed on run #" << i ) );
+			};
+
+			string test_message = "Montgomery context testing. Zero and even moduli rejected. N * N' = -1 (mod 2^512), one converts. "
+				+ to_string( test_run_count ) + " times, each with pseudo random moduli.\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, returned values: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mont_02_round_trip )
+		{
+			// from_mont( to_mont( a ) ) = a mod N, checked against div_u, for random a and random odd N of random length
+			u64 seed = 0;
+			mont_ctx ctx;
+			_UI512( modulus ) { 0 };
+			_UI512( num1 ) { 0 };
+			_UI512( mont ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( quotient ) { 0 };
+			_UI512( expected ) { 0 };
+
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( modulus, &seed );
+				shr_u( modulus, modulus, u16( RandomU64( &seed ) % 500 ) );
+				modulus [ 7 ] |= 1ull;
+				mont_init( &ctx, modulus );
+
+				RandomFill( num1, &seed );
+				div_u( quotient, expected, num1, modulus );
+				to_mont( mont, num1, &ctx );
+				Assert::AreEqual( s16( -1 ), compare_u( mont, modulus ), _MSGW( L"Montgomery form not reduced on run #" << i ) );
+				from_mont( result, mont, &ctx );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Round trip at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = "Montgomery conversion testing. Into Montgomery form, and back out. "
+				+ to_string( test_run_count ) + " times, each with pseudo random values and moduli.\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values (against div_u) via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mont_03_mul )
+		{
+			// Montgomery multiply, checked against mult_u + div_u.
+			// div_u takes a 512 bit dividend, so the products checked must fit in 512 bits:
+			// first with 256 bit moduli (the ECC case), then with full 512 bit moduli and one operand 64 bits.
+			u64 seed = 0;
+			mont_ctx ctx;
+			_UI512( modulus ) { 0 };
+			_UI512( num1 ) { 0 };
+			_UI512( num2 ) { 0 };
+			_UI512( mont1 ) { 0 };
+			_UI512( mont2 ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( product ) { 0 };
+			_UI512( overflow ) { 0 };
+			_UI512( quotient ) { 0 };
+			_UI512( expected ) { 0 };
+
+			for ( int pass = 0; pass < 2; pass++ )
+			{
+				for ( int i = 0; i < test_run_count; i++ )
+				{
+					RandomFill( modulus, &seed );
+					if ( pass == 0 )
+					{
+						shr_u( modulus, modulus, 256 );
+						modulus [ 4 ] |= 0x8000000000000000ull;
+					}
+					else
+					{
+						modulus [ 0 ] |= 0x8000000000000000ull;
+					};
+					modulus [ 7 ] |= 1ull;
+					Assert::AreEqual( s16( 0 ), mont_init( &ctx, modulus ), _MSGW( L"Return code failed on run #" << i ) );
+
+					RandomFill( num1, &seed );
+					RandomFill( num2, &seed );
+					if ( pass == 0 )
+					{
+						div_u( quotient, num1, num1, modulus );
+						div_u( quotient, num2, num2, modulus );
+					}
+					else
+					{
+						shr_u( num1, num1, 64 );
+						set_uT64( num2, num2 [ 7 ] );
+					};
+
+					mult_u( product, overflow, num1, num2 );
+					Assert::AreEqual( s16( -1 ), msb_u( overflow ), _MSGW( L"Test product overflowed on run #" << i ) );
+					div_u( quotient, expected, product, modulus );
+
+					to_mont( mont1, num1, &ctx );
+					to_mont( mont2, num2, &ctx );
+					mont_mul( result, mont1, mont2, &ctx );
+					from_mont( result, result, &ctx );
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Montgomery product at word #" << j << " failed on pass " << pass << " run #" << i ) );
+					};
+				};
+			};
+
+			// Edge moduli: smallest (3), and largest (2^512 - 1), with operands N - 1
+			{
+				_UI512( allones );
+				std::fill_n( allones, 8, u64_Max );
+				set_uT64( modulus, 3ull );
+				mont_init( &ctx, modulus );
+				set_uT64( num1, 2ull );
+				to_mont( mont1, num1, &ctx );
+				mont_mul( result, mont1, mont1, &ctx );
+				from_mont( result, result, &ctx );
+				Assert::AreEqual( s16( 0 ), compare_uT64( result, 1ull ), L"Montgomery product failed (N - 1)^2 mod 3 test." );
+
+				mont_init( &ctx, allones );
+				sub_uT64( num1, allones, 1ull );
+				to_mont( mont1, num1, &ctx );
+				mont_mul( result, mont1, mont1, &ctx );
+				from_mont( result, result, &ctx );
+				Assert::AreEqual( s16( 0 ), compare_uT64( result, 1ull ), L"Montgomery product failed (N - 1)^2 mod 2^512 - 1 test." );
+			}
+
+			string test_message = _MSGA( "Montgomery multiply testing.\n\t256 bit moduli, random operands less than N, "
+				<< test_run_count << " times.\n\t512 bit moduli, random 448 bit by 64 bit operands, " << test_run_count << " times.\n"
+				<< "\tEdge moduli: 3, and 2^512 - 1.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values (against mult_u, div_u) via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mont_04_mul_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Montgomery multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, MontMul );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, MontMul );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, MontMul );
+		};
+
+		TEST_METHOD( ui512mont_05_sqr )
+		{
+			// Montgomery square, checked against Montgomery multiply of the value by itself
+			u64 seed = 0;
+			mont_ctx ctx;
+			_UI512( modulus ) { 0 };
+			_UI512( num1 ) { 0 };
+			_UI512( quotient ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( result ) { 0 };
+
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( modulus, &seed );
+				modulus [ 7 ] |= 1ull;
+				mont_init( &ctx, modulus );
+				RandomFill( num1, &seed );
+				div_u( quotient, num1, num1, modulus );
+
+				mont_mul( expected, num1, num1, &ctx );
+				mont_sqr( result, num1, &ctx );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Montgomery square at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = "Montgomery square testing. " + to_string( test_run_count ) + " times, each with pseudo random values and moduli.\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values (against mont_mul) via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mont_06_sqr_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Montgomery square function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, MontSqr );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, MontSqr );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, MontSqr );
+		};
+	};	// test_class
+};	// namespace
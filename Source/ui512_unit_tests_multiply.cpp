@@ -32,6 +32,7 @@
 
 #include "CppUnitTest.h"
 #include "ui512_externs.h"
+#include "ui512_dispatch.h"
 #include "ui512_unit_tests.h"
 
 #include <cstring>
@@ -47,7 +48,8 @@ namespace ui512_Unit_Tests
 {
 	TEST_CLASS( ui512_unit_tests_multiply )
 	{
-		TEST_METHOD( ui512md_01_mul )
+		// mult_u oracle: run against each implementation of mult_u ( the assembled kernel, and the MULX / ADX version if the host has it )
+		static void MulOracle( s16 ( *mul )( const u64*, const u64*, const u64*, const u64* ), const char* name )
 		{
 			// mult_u tests
 			// multistage testing, part for use as debugging, progressively "real" testing
@@ -69,6 +71,8 @@ namespace ui512_Unit_Tests
 			__m512i b { 0,0,0,0,0,0,0, 2 };
 			__m512i result = _mm512_mul_epu32( a, b ); // VPMULUDQ
 
+			Logger::WriteMessage( _MSGA( "Implementation under test: " << name << "\n\n" ) );
+
 			// Edge case tests
 
 			// 1. zero times zero (don't loop and repeat, just once)
@@ -76,7 +80,7 @@ namespace ui512_Unit_Tests
 			zero_u( num2 );
 			zero_u( expectedproduct );
 			zero_u( expectedoverflow );
-			s16 ret = mult_u( product, overflow, num1, num2 );
+			s16 ret = mul( product, overflow, num1, num2 );
 			Assert::AreEqual( s16( 0 ), ret, L"Return code failed zero times zero test." ); // Only exception possible is parameter alignment
 			for ( int j = 0; j < 8; j++ )
 			{
@@ -91,7 +95,7 @@ namespace ui512_Unit_Tests
 				RandomFill( num2, &seed );
 				zero_u( expectedproduct );
 				zero_u( expectedoverflow );
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed zero times random test." ); // Only exception possible is parameter alignment
 				for ( int j = 0; j < 8; j++ )
 				{
@@ -107,7 +111,7 @@ namespace ui512_Unit_Tests
 				RandomFill( num1, &seed );
 				zero_u( expectedproduct );
 				zero_u( expectedoverflow );
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random times zero test." ); // Only exception possible is parameter alignment
 				for ( int j = 0; j < 8; j++ )
 				{
@@ -123,7 +127,7 @@ namespace ui512_Unit_Tests
 				RandomFill( num2, &seed );
 				copy_u( expectedproduct, num2 );
 				zero_u( expectedoverflow );
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed one times random test." ); // Only exception possible is parameter alignment
 				for ( int j = 0; j < 8; j++ )
 				{
@@ -139,7 +143,7 @@ namespace ui512_Unit_Tests
 				RandomFill( num1, &seed );
 				copy_u( expectedproduct, num1 );
 				zero_u( expectedoverflow );
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random times one test." ); // Only exception possible is parameter alignment
 				for ( int j = 0; j < 8; j++ )
 				{
@@ -165,7 +169,7 @@ namespace ui512_Unit_Tests
 				set_uT64( num2, 2ull );						//	initialize multiplier				
 				shl_u( expectedproduct, num1, u16( 1 ) );		// calculate expected product				
 				shr_u( expectedoverflow, num1, u16( 511 ) );	// calculate expected overflow				
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed simple times two test." ); // Only exception possible is parameter alignment
 
 				//	check actual vs. expected
@@ -192,7 +196,7 @@ namespace ui512_Unit_Tests
 				shl_u( num2, num2, nrShift );
 				shl_u( expectedproduct, num1, nrShift );
 				shr_u( expectedoverflow, num1, ( 512 - nrShift ) );
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random power of 2 test." ); // Only exception possible is parameter alignment
 				for ( int j = 0; j < 8; j++ )
 				{
@@ -216,7 +220,7 @@ namespace ui512_Unit_Tests
 				set_uT64( num2, num2_64 );
 				mult_uT64( expectedproduct, &expectedovfl_64, num1, num2_64 );
 				set_uT64( expectedoverflow, expectedovfl_64 );
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random 64 test." ); // Only exception possible is parameter alignment
 
 				for ( int j = 0; j < 8; j++ )
@@ -306,7 +310,7 @@ namespace ui512_Unit_Tests
 				_UI512( ovfl64 );
 				zero_u( prod64 );
 				zero_u( ovfl64 );
-				s16 ret = mult_u( prod64, ovfl64, num1, num2 );
+				s16 ret = mul( prod64, ovfl64, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random 64 test." ); // Only exception possible is parameter alignment
 
 				// Compare 64bit results to calculated expected results (aborts test if they don't match)
@@ -323,7 +327,7 @@ namespace ui512_Unit_Tests
 				}
 
 				// Got a random multiplicand and multiplier. Execute function under test
-				s16 ret2 = mult_u( product, overflow, num1, num2 );
+				s16 ret2 = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret2, L"Return code failed random 64 test." ); // Only exception possible is parameter alignment
 
 				// Compare results to expected (aborts test if they don't match)
@@ -414,7 +418,7 @@ namespace ui512_Unit_Tests
 				};
 
 				// Got a random multiplicand and multiplier. Execute function under test
-				s16 ret = mult_u( product, overflow, num1, num2 );
+				s16 ret = mul( product, overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed zero times zero test." ); // Only exception possible is parameter alignment
 
 				// Compare results to expected (aborts test if they don't match)
@@ -437,6 +441,14 @@ namespace ui512_Unit_Tests
 			};
 		};
 
+		TEST_METHOD( ui512md_01_mul )
+		{
+			MulOracle( &mult_u, "mult_u" );
+			if ( ui512_mulx_supported( ) )
+			{
+				MulOracle( &mult_u_adx, "mult_u_adx (MULX / ADCX / ADOX)" );
+			};
+		};
 
 		TEST_METHOD( ui512md_01_mul_performance_timing )
 		{
@@ -461,7 +473,8 @@ namespace ui512_Unit_Tests
 
 		};
 
-		TEST_METHOD( ui512md_02_mul64 )
+		// mult_uT64 oracle: run against each implementation of mult_uT64, as MulOracle
+		static void Mul64Oracle( s16 ( *mul64 )( const u64*, const u64*, const u64*, const u64 ), const char* name )
 		{
 			// mult_uT64 tests
 			// multistage testing, part for use as debugging, progressively "real" testing
@@ -482,6 +495,8 @@ namespace ui512_Unit_Tests
 			u64 intermediateovrf = 0;
 			u64 expectedoverflow = 0;
 
+			Logger::WriteMessage( _MSGA( "Implementation under test: " << name << "\n\n" ) );
+
 			// Code walk-thru tests. Curated data to validate in-lane splits, shifts, and singular multiply operations 
 			// during code walk-thru
 			{
@@ -492,7 +507,7 @@ namespace ui512_Unit_Tests
 						0x000000090000000Aul, 0x0000000B0000000Cul, 0x00000000000000Eul, 0x0000000F00000010ul
 				};
 				u64 testm = 0x0000000200000001ul;
-				s16 ret = mult_uT64( product, &overflow, testn, testm );
+				s16 ret = mul64( product, &overflow, testn, testm );
 
 				set_uT64( num2, testm );
 				mult_u( product2, overflow2, testn, num2 );
@@ -512,7 +527,7 @@ namespace ui512_Unit_Tests
 				zero_u( expectedproduct );
 				num2 = 0;
 				expectedoverflow = 0;
-				s16 ret = mult_uT64( product, &overflow, num1, num2 );
+				s16 ret = mul64( product, &overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed zero times zero test." );
 				Assert::AreEqual( expectedoverflow, overflow, _MSGW( L"Overflow failed zero times zero" ) );
 				for ( int j = 0; j < 8; j++ )
@@ -528,7 +543,7 @@ namespace ui512_Unit_Tests
 				zero_u( expectedproduct );
 				num2 = RandomU64( &seed );
 				expectedoverflow = 0;
-				s16 ret = mult_uT64( product, &overflow, num1, num2 );
+				s16 ret = mul64( product, &overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed zero times random test." );
 				Assert::AreEqual( expectedoverflow, overflow, _MSGW( L"Overflow  failed zero times random " << i ) );
 				for ( int j = 0; j < 8; j++ )
@@ -544,7 +559,7 @@ namespace ui512_Unit_Tests
 				RandomFill( num1, &seed );
 				zero_u( expectedproduct );
 				expectedoverflow = 0;
-				s16 ret = mult_uT64( product, &overflow, num1, num2 );
+				s16 ret = mul64( product, &overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random times zero test." );
 				Assert::AreEqual( expectedoverflow, overflow, _MSGW( L"Overflow failed random times zero " << i ) );
 				for ( int j = 0; j < 8; j++ )
@@ -560,7 +575,7 @@ namespace ui512_Unit_Tests
 				num2 = RandomU64( &seed );
 				set_uT64( expectedproduct, num2 );
 				expectedoverflow = 0;
-				s16 ret = mult_uT64( product, &overflow, num1, num2 );
+				s16 ret = mul64( product, &overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed one times random test." );
 				Assert::AreEqual( expectedoverflow, overflow, _MSGW( L"Overflow failed one times random on run #" << i ) );
 				for ( int j = 0; j < 8; j++ )
@@ -576,7 +591,7 @@ namespace ui512_Unit_Tests
 				RandomFill( num1, &seed );
 				copy_u( expectedproduct, num1 );
 				expectedoverflow = 0;
-				s16 ret = mult_uT64( product, &overflow, num1, num2 );
+				s16 ret = mul64( product, &overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random times one test." );
 				Assert::AreEqual( expectedoverflow, overflow, _MSGW( L"Overflow failed random times one on run #" << i ) );
 				for ( int j = 0; j < 8; j++ )
@@ -606,7 +621,7 @@ namespace ui512_Unit_Tests
 				num2 = 2;
 				shl_u( expectedproduct, num1, u16( 1 ) );
 				expectedoverflow = num1 [ 0 ] >> 63;
-				s16 ret = mult_uT64( product, &overflow, num1, num2 );
+				s16 ret = mul64( product, &overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random times one test." );
 				Assert::AreEqual( expectedoverflow, overflow, _MSGW( L"Overflow failed " << i ) );
 				for ( int j = 0; j < 8; j++ )
@@ -631,7 +646,7 @@ namespace ui512_Unit_Tests
 					num2 = 1ull << nrShift;
 					shl_u( expectedproduct, num1, nrShift );
 					expectedoverflow = ( nrShift == 0 ) ? 0 : num1 [ 0 ] >> ( 64 - nrShift );
-					s16 ret = mult_uT64( product, &overflow, num1, num2 );
+					s16 ret = mul64( product, &overflow, num1, num2 );
 					Assert::AreEqual( s16( 0 ), ret, L"Return code failed random times one test." );
 					for ( int j = 0; j < 8; j++ )
 					{
@@ -719,7 +734,7 @@ namespace ui512_Unit_Tests
 					};
 				};
 
-				s16 ret = mult_uT64( product, &overflow, num1, num2 );
+				s16 ret = mul64( product, &overflow, num1, num2 );
 				Assert::AreEqual( s16( 0 ), ret, L"Return code failed random times one test." );
 				// Now compare results
 				for ( int j = 0; j < 8; j++ )
@@ -736,6 +751,15 @@ namespace ui512_Unit_Tests
 			}
 		};
 
+		TEST_METHOD( ui512md_02_mul64 )
+		{
+			Mul64Oracle( &mult_uT64, "mult_uT64" );
+			if ( ui512_mulx_supported( ) )
+			{
+				Mul64Oracle( &mult_uT64_adx, "mult_uT64_adx (MULX / ADCX)" );
+			};
+		};
+
 		TEST_METHOD( ui512md_02_mul64_performance_timing )
 		{
 			// Performance timing tests.
@@ -758,5 +782,350 @@ namespace ui512_Unit_Tests
 			RunStats( &No3, Mul64 );
 		};
 
+		TEST_METHOD( ui512md_03_sqr )
+		{
+			// sqr_u tests, against mult_u with multiplier == multiplicand
+			// Note: mult_u must pass testing before these tests
+
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( product ) { 0 };
+			_UI512( overflow ) { 0 };
+			_UI512( expectedproduct ) { 0 };
+			_UI512( expectedoverflow ) { 0 };
+
+			// 1. edges: zero, one, all ones ( every cross product and carry at its largest )
+			for ( int edge = 0; edge < 3; edge++ )
+			{
+				zero_u( num1 );
+				if ( edge == 1 )
+				{
+					set_uT64( num1, 1ull );
+				}
+				else if ( edge == 2 )
+				{
+					std::fill_n( num1, 8, u64_Max );
+				};
+				mult_u( expectedproduct, expectedoverflow, num1, num1 );
+				s16 retcode = sqr_u( product, overflow, num1 );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed edge #" << edge ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedproduct [ j ], product [ j ], _MSGW( L"Product at word #" << j << " failed edge #" << edge ) );
+					Assert::AreEqual( expectedoverflow [ j ], overflow [ j ], _MSGW( L"Overflow at word #" << j << " failed edge #" << edge ) );
+				};
+			};
+
+			// 2. random values of every bit length; then in place ( product written over multiplicand )
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( num1, &seed );
+				shr_u( num1, num1, u16( i % 512 ) );
+				mult_u( expectedproduct, expectedoverflow, num1, num1 );
+				sqr_u( product, overflow, num1 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedproduct [ j ], product [ j ], _MSGW( L"Product at word #" << j << " failed on run #" << i ) );
+					Assert::AreEqual( expectedoverflow [ j ], overflow [ j ], _MSGW( L"Overflow at word #" << j << " failed on run #" << i ) );
+				};
+				sqr_u( num1, overflow, num1 );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedproduct [ j ], num1 [ j ], _MSGW( L"In place product at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Square function testing. Edge cases, then " << test_run_count << " pseudo-random values of every bit length, in place and not.\n" );
+			test_message += "Passed. Products and overflows verified against mult_u; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512md_03_sqr_performance_timing )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Compare with ui512md_01_mul_performance_timing
+
+			Logger::WriteMessage( L"Square function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Sqr );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Sqr );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Sqr );
+		};
+
+		TEST_METHOD( ui512md_04_mul_lo_hi )
+		{
+			// mult_u_lo, mult_u_hi tests, against the product and overflow halves of mult_u
+			// Note: mult_u must pass testing before these tests
+
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			_UI512( num2 ) { 0 };
+			_UI512( product ) { 0 };
+			_UI512( overflow ) { 0 };
+			_UI512( expectedproduct ) { 0 };
+			_UI512( expectedoverflow ) { 0 };
+
+			// random values of every bit length; every fourth run with random qwords set to all ones, to drive the high
+			// columns ( and the mult_u_hi carry check ) to their limits; each also in place
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( num1, &seed );
+				RandomFill( num2, &seed );
+				shr_u( num1, num1, u16( i % 512 ) );
+				if ( i % 4 == 3 )
+				{
+					u64 pick = RandomU64( &seed );
+					for ( int j = 0; j < 8; j++ )
+					{
+						num1 [ j ] = ( ( pick >> j ) & 1 ) ? u64_Max : num1 [ j ];
+						num2 [ j ] = ( ( pick >> ( j + 8 ) ) & 1 ) ? u64_Max : num2 [ j ];
+					};
+				};
+				mult_u( expectedproduct, expectedoverflow, num1, num2 );
+				s16 retcode = mult_u_lo( product, num1, num2 );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed low half on run #" << i ) );
+				retcode = mult_u_hi( overflow, num1, num2 );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed high half on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedproduct [ j ], product [ j ], _MSGW( L"Product at word #" << j << " failed on run #" << i ) );
+					Assert::AreEqual( expectedoverflow [ j ], overflow [ j ], _MSGW( L"Overflow at word #" << j << " failed on run #" << i ) );
+				};
+
+				copy_u( product, num1 );
+				mult_u_lo( product, product, num2 );
+				copy_u( overflow, num2 );
+				mult_u_hi( overflow, num1, overflow );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedproduct [ j ], product [ j ], _MSGW( L"In place product at word #" << j << " failed on run #" << i ) );
+					Assert::AreEqual( expectedoverflow [ j ], overflow [ j ], _MSGW( L"In place overflow at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			// all ones squared: the high half carry check must take the full path
+			std::fill_n( num1, 8, u64_Max );
+			mult_u( expectedproduct, expectedoverflow, num1, num1 );
+			mult_u_lo( product, num1, num1 );
+			mult_u_hi( overflow, num1, num1 );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expectedproduct [ j ], product [ j ], _MSGW( L"Product at word #" << j << " failed all ones" ) );
+				Assert::AreEqual( expectedoverflow [ j ], overflow [ j ], _MSGW( L"Overflow at word #" << j << " failed all ones" ) );
+			};
+
+			string test_message = _MSGA( "Half product multiply function testing. " << test_run_count << " pseudo-random pairs of every bit length, in place and not.\n" );
+			test_message += "Passed. Low and high halves verified against mult_u; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512md_04_mul_lo_hi_performance_timing )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Full multiply first, for comparison, then the low half, then the high half
+
+			Logger::WriteMessage( L"Multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Mul );
+
+			Logger::WriteMessage( L"Multiply, low half, function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 0 ];
+			RunStats( &No2, MulLo );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 1 ];
+			RunStats( &No3, MulLo );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 2 ];
+			RunStats( &No4, MulLo );
+
+			Logger::WriteMessage( L"Multiply, high half, function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 0 ];
+			RunStats( &No5, MulHi );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 1 ];
+			RunStats( &No6, MulHi );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No7 = Perf_Test_Parms [ 2 ];
+			RunStats( &No7, MulHi );
+		};
+
+		TEST_METHOD( ui512md_05_mul_adx_performance_timing )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Compare with ui512md_01_mul_performance_timing, ui512md_02_mul64_performance_timing
+
+			if ( !ui512_mulx_supported( ) )
+			{
+				Logger::WriteMessage( L"Multiply ( MULX / ADX ) function performance timing test: host lacks BMI2 or ADX; not run.\n\n" );
+				return;
+			};
+
+			Logger::WriteMessage( L"Multiply ( MULX / ADX ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, MulAdx );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, MulAdx );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, MulAdx );
+
+			Logger::WriteMessage( L"Multiply by 64 bit ( MULX / ADX ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No4 = Perf_Test_Parms [ 0 ];
+			RunStats( &No4, Mul64Adx );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No5 = Perf_Test_Parms [ 1 ];
+			RunStats( &No5, Mul64Adx );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No6 = Perf_Test_Parms [ 2 ];
+			RunStats( &No6, Mul64Adx );
+		};
+
+		TEST_METHOD( ui512md_06_mul_x4 )
+		{
+			// mult_u_x4 tests, each of the four against mult_u
+			// Note: mult_u must pass testing before these tests
+
+			u64 seed = 0;
+			_UI512( num1 ) { 0 };
+			alignas ( 64 ) u64 a [ 4 ] [ 8 ] { };
+			alignas ( 64 ) u64 b [ 4 ] [ 8 ] { };
+			alignas ( 64 ) u64 product [ 4 ] [ 8 ] { };
+			alignas ( 64 ) u64 overflow [ 4 ] [ 8 ] { };
+			alignas ( 64 ) u64 expectedproduct [ 4 ] [ 8 ] { };
+			alignas ( 64 ) u64 expectedoverflow [ 4 ] [ 8 ] { };
+			u64* products [ 4 ] = { product [ 0 ], product [ 1 ], product [ 2 ], product [ 3 ] };
+			u64* overflows [ 4 ] = { overflow [ 0 ], overflow [ 1 ], overflow [ 2 ], overflow [ 3 ] };
+			const u64* multiplicands [ 4 ] = { a [ 0 ], a [ 1 ], a [ 2 ], a [ 3 ] };
+			const u64* multipliers [ 4 ] = { b [ 0 ], b [ 1 ], b [ 2 ], b [ 3 ] };
+
+			// random values of differing bit lengths in each of the four, every fourth run one of them all ones
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				for ( int n = 0; n < 4; n++ )
+				{
+					RandomFill( a [ n ], &seed );
+					RandomFill( b [ n ], &seed );
+					shr_u( a [ n ], a [ n ], u16( ( i + 128 * n ) % 512 ) );
+				};
+				if ( i % 4 == 3 )
+				{
+					std::fill_n( a [ i % 16 / 4 ], 8, u64_Max );
+					std::fill_n( b [ i % 16 / 4 ], 8, u64_Max );
+				};
+				for ( int n = 0; n < 4; n++ )
+				{
+					mult_u( expectedproduct [ n ], expectedoverflow [ n ], a [ n ], b [ n ] );
+				};
+				s16 retcode = mult_u_x4( products, overflows, multiplicands, multipliers );
+				Assert::AreEqual( s16( 0 ), retcode, _MSGW( L"Return code failed on run #" << i ) );
+				for ( int n = 0; n < 4; n++ )
+				{
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expectedproduct [ n ] [ j ], product [ n ] [ j ], _MSGW( L"Product #" << n << " at word #" << j << " failed on run #" << i ) );
+						Assert::AreEqual( expectedoverflow [ n ] [ j ], overflow [ n ] [ j ], _MSGW( L"Overflow #" << n << " at word #" << j << " failed on run #" << i ) );
+					};
+				};
+			};
+
+			// in place, and one operand in all four: products over the multiplicands, overflows over the multipliers, a [ 0 ] in each
+			for ( int n = 0; n < 4; n++ )
+			{
+				RandomFill( b [ n ], &seed );
+				mult_u( expectedproduct [ n ], expectedoverflow [ n ], a [ 0 ], b [ n ] );
+			};
+			copy_u( num1, a [ 0 ] );
+			const u64* shared [ 4 ] = { num1, num1, num1, num1 };
+			u64* into_a [ 4 ] = { a [ 0 ], a [ 1 ], a [ 2 ], a [ 3 ] };
+			u64* into_b [ 4 ] = { b [ 0 ], b [ 1 ], b [ 2 ], b [ 3 ] };
+			mult_u_x4( into_a, into_b, shared, multipliers );
+			for ( int n = 0; n < 4; n++ )
+			{
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expectedproduct [ n ] [ j ], a [ n ] [ j ], _MSGW( L"In place product #" << n << " at word #" << j << " failed" ) );
+					Assert::AreEqual( expectedoverflow [ n ] [ j ], b [ n ] [ j ], _MSGW( L"In place overflow #" << n << " at word #" << j << " failed" ) );
+				};
+			};
+
+			string test_message = _MSGA( "Four per call multiply function testing. " << test_run_count << " sets of four pseudo-random pairs, of differing bit lengths; in place.\n" );
+			test_message += "Passed. Each product and overflow verified against mult_u; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512md_06_mul_x4_performance_timing )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Each sample is four products: one mult_u_x4 call, then, for comparison, four mult_u calls back to back
+
+			const Perf_Tests tests [ 2 ] = { MulX4, Mul4Calls };
+			const wchar_t* titles [ 2 ] = {
+				L"Multiply, four per call ( two interleaved pairs ), function performance timing test.\n\n",
+				L"Multiply, four calls back to back, performance timing test, for comparison.\n\n" };
+			double per_product [ 2 ] = { 0 };
+			double per_product_throughput [ 2 ] = { 0 };
+			for ( int t = 0; t < 2; t++ )
+			{
+				Logger::WriteMessage( titles [ t ] );
+
+				Logger::WriteMessage( L"First run.\n" );
+				perf_stats No1 = Perf_Test_Parms [ 0 ];
+				RunStats( &No1, tests [ t ] );
+
+				Logger::WriteMessage( L"Second run.\n" );
+				perf_stats No2 = Perf_Test_Parms [ 1 ];
+				RunStats( &No2, tests [ t ] );
+
+				Logger::WriteMessage( L"Third run.\n" );
+				perf_stats No3 = Perf_Test_Parms [ 2 ];
+				RunStats( &No3, tests [ t ] );
+				per_product [ t ] = No3.mean / 4.0;
+				per_product_throughput [ t ] = No3.throughput_cycles / 4.0;
+			};
+
+			string message = format( "Clock cycles per product ( third runs ): paired \t{:6.2f}, back to back \t{:6.2f}\n", per_product [ 0 ], per_product [ 1 ] );
+			message += format( "Throughput, clock cycles per product: paired \t{:6.2f}, back to back \t{:6.2f}\n\n", per_product_throughput [ 0 ], per_product_throughput [ 1 ] );
+			Logger::WriteMessage( message.c_str( ) );
+		};
+
 	};	// test_class
 };	// namespace
\ No newline at end of file
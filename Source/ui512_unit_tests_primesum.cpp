@@ -0,0 +1,330 @@
+//		ui512_unit_tests_primesum
+//
+//		File:			ui512_unit_tests_primesum.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_primesum.h"
+#include "ui512_unit_tests.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_primesum )
+	{
+		// sum of primes <= n, for every n to max: a plain sieve, then running totals ( fit a qword to 10^7 and beyond )
+		static void PrimeSumReference( std::vector<u64>* sums, u64 max )
+		{
+			std::vector<bool> composite( size_t( max + 1 ), false );
+			sums->assign( size_t( max + 1 ), 0 );
+			u64 total = 0;
+			for ( u64 i = 2; i <= max; i++ )
+			{
+				if ( !composite [ size_t( i ) ] )
+				{
+					total += i;
+					for ( u64 j = i * i; j <= max; j += i )
+					{
+						composite [ size_t( j ) ] = true;
+					};
+				};
+				( *sums ) [ size_t( i ) ] = total;
+			};
+		};
+
+		TEST_METHOD( ui512primesum_01_sum_primes )
+		{
+			_UI512( sum ) { 0 };
+			_UI512( expected ) { 0 };
+			primesum_stats stats;
+
+			// 1. refused arguments
+			Assert::AreEqual( s16( -1 ), sum_primes_u( sum, primesum_limit_max + 1, 1 ), L"Return code failed limit over the maximum" );
+			Assert::AreEqual( s16( -1 ), sum_primes_u( sum, 1000, -1 ), L"Return code failed negative threads" );
+
+			// 2. every limit to 1000 ( wheel primes, pattern primes, the first sieving primes and their squares ), one thread
+			const u64 ref_max = 10000000;
+			std::vector<u64> ref;
+			PrimeSumReference( &ref, ref_max );
+			for ( u64 n = 0; n <= 1000; n++ )
+			{
+				Assert::AreEqual( s16( 0 ), sum_primes_u( sum, n, 1 ), L"Return code failed small limit" );
+				set_uT64( expected, ref [ size_t( n ) ] );
+				Assert::AreEqual( 0, compare_u( sum, expected ), _MSGW( L"Sum failed at limit " << n ) );
+			};
+
+			// 3. limits either side of segment boundaries, and pseudo-random limits, against the reference; two threads
+			const u64 span = u64( primesum_segment_bytes ) * 30;
+			std::vector<u64> limits;
+			for ( u64 k = 1; k * span + 1 <= ref_max; k++ )
+			{
+				limits.push_back( k * span - 1 );
+				limits.push_back( k * span );
+				limits.push_back( k * span + 1 );
+			};
+			u64 seed = 0;
+			for ( int i = 0; i < 50; i++ )
+			{
+				limits.push_back( RandomU64( &seed ) % ( ref_max + 1 ) );
+			};
+			for ( u64 n : limits )
+			{
+				sum_primes_u( sum, n, 2, &stats );
+				set_uT64( expected, ref [ size_t( n ) ] );
+				Assert::AreEqual( 0, compare_u( sum, expected ), _MSGW( L"Sum failed at limit " << n ) );
+			};
+
+			// 4. known values ( sums of primes below 10^k, OEIS A046731 ), the same for any thread count; 10^10: sieving primes past
+			// one segment ( 32768 ), so the bucketed primes and their ring are in play
+			const u64 known_limit [ ] = { 1999999, 100000000, 1000000000, 10000000000ull };
+			const u64 known_sum [ ] = { 142913828922ull, 279209790387276ull, 24739512092254535ull, 2220822432581729238ull };
+			const u64 known_count [ ] = { 148933, 5761455, 50847534, 455052511 };
+			int max_threads = int( std::thread::hardware_concurrency( ) );
+			max_threads = ( max_threads < 2 ) ? 2 : ( max_threads > 8 ) ? 8 : max_threads;
+			for ( int k = 0; k < 4; k++ )
+			{
+				for ( int threads = 1; threads <= max_threads; threads *= 2 )
+				{
+					sum_primes_u( sum, known_limit [ k ], threads, &stats );
+					set_uT64( expected, known_sum [ k ] );
+					Assert::AreEqual( 0, compare_u( sum, expected ), _MSGW( L"Known sum failed at limit " << known_limit [ k ] << L", threads " << threads ) );
+					Assert::AreEqual( known_count [ k ], stats.primes, _MSGW( L"Prime count failed at limit " << known_limit [ k ] ) );
+					Assert::IsTrue( stats.threads >= 1 && stats.threads <= threads, L"Stats thread count failed" );
+				};
+			};
+
+			string test_message = _MSGA( "Sum of primes testing. Refused arguments; every limit to 1000; " << limits.size( )
+				<< " limits to " << ref_max << " at segment boundaries and pseudo-random; known sums to 10^10 with 1 to " << max_threads << " threads.\n" );
+			test_message += "Passed. Sums verified against a plain sieve and published values, counts against pi( x ); each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512primesum_02_performance )
+		{
+			// Performance timing, by thread count. Not pass/fail, informational only.
+			// Wall clock ( steady_clock, inside sum_primes_u ) from the sieving primes through the final fold.
+			// Ideal scaling keeps primes per second rising with the thread count; steals show the balancing at work.
+
+			const u64 limits [ ] = { 100000000ull, 1000000000ull, 10000000000ull };
+			int max_threads = int( std::thread::hardware_concurrency( ) );
+			max_threads = ( max_threads < 1 ) ? 1 : max_threads;
+			std::vector<int> counts;
+			for ( int threads = 1; threads < max_threads; threads *= 2 )
+			{
+				counts.push_back( threads );
+			};
+			counts.push_back( max_threads );
+
+			_UI512( sum ) { 0 };
+			primesum_stats stats;
+			string test_message = _MSGA( "Sum of primes performance, up to " << max_threads << " threads.\n" );
+			for ( u64 limit : limits )
+			{
+				test_message += _MSGA( "limit " << limit << "\nthreads\tseconds\t\tprimes/s\tspeed up\tchunks\tsteals\n" );
+				double one = 0;
+				for ( int threads : counts )
+				{
+					sum_primes_u( sum, limit, threads, &stats );
+					one = ( threads == 1 ) ? stats.primes_per_second : one;
+					test_message += _MSGA( stats.threads << "\t" << stats.seconds << "\t" << stats.primes_per_second << "\t"
+						<< stats.primes_per_second / one << "\t\t" << stats.chunks << "\t" << stats.steals << "\n" );
+				};
+				test_message += _MSGA( "sum " << sum [ 6 ] << ":" << sum [ 7 ] << " ( high:low qwords ), " << stats.primes << " primes\n" );
+			};
+			test_message += "\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512primesum_03_lucy )
+		{
+			_UI512( sum ) { 0 };
+			_UI512( sieved ) { 0 };
+			_UI512( expected ) { 0 };
+			primesum_stats stats;
+			primesum_stats sieve_stats;
+
+			// 1. refused method
+			Assert::AreEqual( s16( -1 ), sum_primes_u( sum, 1000, 1, nullptr, primesum_method( 2 ) ), L"Return code failed unknown method" );
+
+			// 2. every limit to 1000, and pseudo-random limits to 10^7, against the reference
+			const u64 ref_max = 10000000;
+			std::vector<u64> ref;
+			PrimeSumReference( &ref, ref_max );
+			u64 seed = 0;
+			for ( int i = 0; i <= 1100; i++ )
+			{
+				u64 n = ( i <= 1000 ) ? u64( i ) : RandomU64( &seed ) % ( ref_max + 1 );
+				Assert::AreEqual( s16( 0 ), sum_primes_u( sum, n, 1, nullptr, primesum_lucy ), L"Return code failed" );
+				set_uT64( expected, ref [ size_t( n ) ] );
+				Assert::AreEqual( 0, compare_u( sum, expected ), _MSGW( L"Sum failed at limit " << n ) );
+			};
+
+			// 3. pseudo-random limits to 10^9, against the sieve: sums and counts
+			for ( int i = 0; i < 10; i++ )
+			{
+				u64 n = RandomU64( &seed ) % 1000000001ull;
+				sum_primes_u( sum, n, 0, &stats, primesum_lucy );
+				sum_primes_u( sieved, n, 0, &sieve_stats, primesum_sieve );
+				Assert::AreEqual( 0, compare_u( sum, sieved ), _MSGW( L"Sum differs from the sieve at limit " << n ) );
+				Assert::AreEqual( sieve_stats.primes, stats.primes, _MSGW( L"Count differs from the sieve at limit " << n ) );
+			};
+
+			// 4. known value past a qword: sum of primes below 10^11 ( OEIS A046731 ) is 10 * 2^64 + 16999637006649164854; pi( 10^11 )
+			sum_primes_u( sum, 99999999999ull, 1, &stats, primesum_lucy );
+			zero_u( expected );
+			expected [ 6 ] = 10ull;
+			expected [ 7 ] = 16999637006649164854ull;
+			Assert::AreEqual( 0, compare_u( sum, expected ), L"Known sum failed below 10^11" );
+			Assert::AreEqual( 4118054813ull, stats.primes, L"Prime count failed below 10^11" );
+
+			string test_message = _MSGA( "Lucy_Hedgehog sum of primes testing. Refused method; every limit to 1000 and 100 pseudo-random limits to "
+				<< ref_max << "; 10 pseudo-random limits to 10^9 against the sieve; known sum below 10^11.\n" );
+			test_message += "Passed. Sums verified against a plain sieve, the segmented sieve and published values, counts against pi( x ); each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512primesum_04_crossover_performance )
+		{
+			// Performance timing, sieve ( all threads ) against Lucy_Hedgehog ( one thread ), by limit. Not pass/fail, informational only.
+			// The sieve's work grows as n, Lucy_Hedgehog's as n^3/4 ( but each step is 512 bit ); the crossover is the first limit
+			// from which Lucy_Hedgehog stays ahead. Wall clock ( steady_clock, inside sum_primes_u ), best of three runs each.
+
+			_UI512( sum ) { 0 };
+			primesum_stats stats;
+			int threads = int( std::thread::hardware_concurrency( ) );
+			threads = ( threads < 1 ) ? 1 : threads;
+
+			string test_message = _MSGA( "Sum of primes, sieve ( " << threads << " threads ) against Lucy_Hedgehog ( 1 thread ).\n" );
+			test_message += "limit\t\tsieve s\t\tLucy s\t\tsieve / Lucy\n";
+			u64 crossover = 0;
+			for ( u64 limit = 1000; limit <= 10000000000ull; limit *= 10 )
+			{
+				double best [ 2 ] = { 0, 0 };
+				const primesum_method methods [ 2 ] = { primesum_sieve, primesum_lucy };
+				for ( int m = 0; m < 2; m++ )
+				{
+					for ( int run = 0; run < 3; run++ )
+					{
+						sum_primes_u( sum, limit, threads, &stats, methods [ m ] );
+						best [ m ] = ( run == 0 || stats.seconds < best [ m ] ) ? stats.seconds : best [ m ];
+					};
+				};
+				crossover = ( best [ 1 ] >= best [ 0 ] ) ? 0 : ( crossover == 0 ) ? limit : crossover;
+				test_message += _MSGA( limit << "\t" << best [ 0 ] << "\t" << best [ 1 ] << "\t" << best [ 0 ] / best [ 1 ] << "\n" );
+			};
+			if ( crossover == 0 )
+			{
+				test_message += "No crossover: the sieve was ahead at the largest limit.\n";
+			}
+			else
+			{
+				test_message += _MSGA( "Crossover: Lucy_Hedgehog ahead from limit " << crossover << " on.\n" );
+			};
+			test_message += "\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512primesum_05_checkpoint )
+		{
+			_UI512( sum ) { 0 };
+			_UI512( expected ) { 0 };
+			primesum_stats stats;
+			const char* path = "ui512_primesum_test.ckpt";
+			std::remove( path );
+
+			// 1. record layout; refused arguments
+			Assert::AreEqual( size_t( 640 ), sizeof( primesum_record ), L"Record size failed" );
+			Assert::AreEqual( s16( -1 ), sum_primes_resumable_u( sum, 1000, nullptr, 1.0 ), L"Return code failed no path" );
+			Assert::AreEqual( s16( -1 ), sum_primes_resumable_u( sum, 1000, path, 0.0 ), L"Return code failed zero interval" );
+
+			// 2. a whole run, then a rerun from its finished checkpoint ( nothing left to sieve ); another limit on the same file refused
+			const u64 limit = 100000000;
+			set_uT64( expected, 279209790387276ull );
+			Assert::AreEqual( s16( 0 ), sum_primes_resumable_u( sum, limit, path, 0.01, nullptr, 2, &stats ), L"Return code failed whole run" );
+			Assert::AreEqual( 0, compare_u( sum, expected ), L"Sum failed whole run" );
+			Assert::AreEqual( 5761455ull, stats.primes, L"Count failed whole run" );
+			Assert::AreEqual( 0ull, stats.resumed, L"Whole run resumed chunks" );
+			Assert::IsTrue( stats.checkpoints >= 1, L"Whole run wrote no checkpoint" );
+			const u64 chunks = stats.chunks;
+			Assert::AreEqual( s16( 0 ), sum_primes_resumable_u( sum, limit, path, 0.01, nullptr, 2, &stats ), L"Return code failed rerun" );
+			Assert::AreEqual( 0, compare_u( sum, expected ), L"Sum failed rerun" );
+			Assert::AreEqual( 5761455ull, stats.primes, L"Count failed rerun" );
+			Assert::AreEqual( chunks, stats.resumed, L"Rerun did not resume every chunk" );
+			Assert::AreEqual( s16( -1 ), sum_primes_resumable_u( sum, limit + 1, path, 0.01 ), L"Return code failed other limit" );
+
+			// 3. newer slot damaged: the restart takes the older one ( or starts over, if there was only one ), and the sum still comes out right
+			primesum_record slot [ 2 ];
+			std::fstream file( path, std::ios::in | std::ios::out | std::ios::binary );
+			file.read( ( char* ) slot, sizeof( slot ) );
+			int newer = ( slot [ 1 ].sequence > slot [ 0 ].sequence ) ? 1 : 0;
+			slot [ newer ].sum [ 7 ] ^= 1;
+			file.seekp( std::streamoff( newer * sizeof( primesum_record ) ) );
+			file.write( ( const char* ) &slot [ newer ], sizeof( primesum_record ) );
+			file.close( );
+			Assert::AreEqual( s16( 0 ), sum_primes_resumable_u( sum, limit, path, 0.01, nullptr, 2, &stats ), L"Return code failed damaged slot" );
+			Assert::AreEqual( 0, compare_u( sum, expected ), L"Sum failed damaged slot" );
+			Assert::IsTrue( stats.resumed < chunks, L"Damaged slot was used" );
+
+			// 4. stopped part way ( one thread, stop after 100 ms ), then resumed on all threads
+			std::remove( path );
+			const u64 long_limit = 10000000000ull;
+			std::atomic<bool> stop { false };
+			std::thread stopper( [ &stop ] ( )
+				{
+					std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+					stop = true;
+				} );
+			s16 rc = sum_primes_resumable_u( sum, long_limit, path, 0.02, &stop, 1, &stats );
+			stopper.join( );
+			Assert::AreEqual( s16( 1 ), rc, L"Return code failed stopped run" );
+			u64 stopped_primes = stats.primes;
+			Assert::AreEqual( s16( 0 ), sum_primes_resumable_u( sum, long_limit, path, 1.0, nullptr, 0, &stats ), L"Return code failed resumed run" );
+			set_uT64( expected, 2220822432581729238ull );
+			Assert::AreEqual( 0, compare_u( sum, expected ), L"Sum failed resumed run" );
+			Assert::AreEqual( 455052511ull, stats.primes, L"Count failed resumed run" );
+			Assert::IsTrue( stats.resumed > 0 && stats.resumed < stats.chunks, L"Resumed run did not pick up the stopped run's chunks" );
+			std::remove( path );
+
+			string test_message = _MSGA( "Sum of primes checkpoint testing. Record layout, refused arguments; whole run to " << limit << ", rerun, other limit; "
+				"damaged newer slot; run to " << long_limit << " stopped after 100 ms ( " << stopped_primes << " primes ), resumed on all threads.\n" );
+			test_message += "Passed. Sums and counts verified against published values, resumed chunks against the checkpoint; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+	};
+};
@@ -0,0 +1,289 @@
+//		ui512_unit_tests_roots
+//
+//		File:			ui512_unit_tests_roots.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_roots.h"
+#include "ui512_unit_tests.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_roots )
+	{
+		// p = x^k by repeated mult_u; false if it passes 512 bits
+		static bool PowReference( u64* p, const u64* x, u32 k )
+		{
+			_UI512( hi ) { 0 };
+			set_uT64( p, 1ull );
+			for ( u32 i = 0; i < k; i++ )
+			{
+				mult_u( p, hi, p, x );
+				if ( compare_uT64( hi, 0ull ) != 0 )
+				{
+					return false;
+				};
+			};
+			return true;
+		};
+
+		// root^k <= value < ( root + 1 )^k
+		static bool IsFloorRoot( const u64* root, const u64* value, u32 k )
+		{
+			_UI512( p ) { 0 };
+			_UI512( next ) { 0 };
+			if ( !PowReference( p, root, k ) || compare_u( p, value ) > 0 )
+			{
+				return false;
+			};
+			add_uT64( next, root, 1ull );
+			return !PowReference( p, next, k ) || compare_u( p, value ) > 0;
+		};
+
+		TEST_METHOD( ui512roots_01_isqrt )
+		{
+			u64 seed = 0;
+			_UI512( value ) { 0 };
+			_UI512( root ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( hi ) { 0 };
+
+			// 1. small values, 2^512 - 1
+			const u64 small [ 10 ] = { 0, 1, 2, 3, 4, 5, 8, 9, 15, 16 };
+			const u64 small_roots [ 10 ] = { 0, 1, 1, 1, 2, 2, 2, 3, 3, 4 };
+			for ( int i = 0; i < 10; i++ )
+			{
+				set_uT64( value, small [ i ] );
+				isqrt_u( root, value );
+				Assert::AreEqual( 0, compare_uT64( root, small_roots [ i ] ), _MSGW( L"Failed isqrt of " << small [ i ] ) );
+			};
+			std::fill_n( value, 8, u64_Max );
+			isqrt_u( root, value );
+			zero_u( expected );
+			expected [ 4 ] = expected [ 5 ] = expected [ 6 ] = expected [ 7 ] = u64_Max;
+			Assert::AreEqual( 0, compare_u( root, expected ), L"Failed isqrt of 2^512 - 1" );
+
+			// 2. squares, and one either side, for roots of every length
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( expected, &seed );
+				shr_u( expected, expected, u16( 256 + i % 256 ) );
+				if ( compare_uT64( expected, 0ull ) == 0 )
+				{
+					set_uT64( expected, 1ull );
+				};
+				mult_u( value, hi, expected, expected );
+				isqrt_u( root, value );
+				Assert::AreEqual( 0, compare_u( root, expected ), _MSGW( L"Failed square on run #" << i ) );
+				add_uT64( value, value, 1ull );
+				isqrt_u( root, value );
+				Assert::AreEqual( 0, compare_u( root, expected ), _MSGW( L"Failed square + 1 on run #" << i ) );
+				sub_uT64( value, value, 2ull );
+				isqrt_u( root, value );
+				sub_uT64( expected, expected, 1ull );
+				Assert::AreEqual( 0, compare_u( root, expected ), _MSGW( L"Failed square - 1 on run #" << i ) );
+			};
+
+			// 3. random values of every length, against the bit at a time root
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( value, &seed );
+				shr_u( value, value, u16( i % 512 ) );
+				isqrt_u( root, value );
+				IsqrtBitwise( expected, value );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], root [ j ], _MSGW( L"Result at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Integer square root function testing. Small values, 2^512 - 1; " << test_run_count
+				<< " squares ( and either side ) of every length; " << test_run_count << " pseudo-random values against a bit at a time root.\n" );
+			test_message += "Passed. Each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512roots_02_iroot )
+		{
+			u64 seed = 0;
+			_UI512( value ) { 0 };
+			_UI512( root ) { 0 };
+			_UI512( base ) { 0 };
+
+			// 1. k zero refused; k one is the value; 2^511 for every k
+			Assert::AreEqual( s16( -1 ), iroot_u( root, value, 0 ), L"Return code failed k zero" );
+			RandomFill( value, &seed );
+			iroot_u( root, value, 1 );
+			Assert::AreEqual( 0, compare_u( root, value ), L"Failed k one" );
+			zero_u( value );
+			value [ 0 ] = 0x8000000000000000ull;
+			for ( u32 k = 1; k <= 600; k++ )
+			{
+				iroot_u( root, value, k );
+				Assert::IsTrue( IsFloorRoot( root, value, k ), _MSGW( L"Failed 2^511, k " << k ) );
+			};
+
+			// 2. random values of every length, random k ( mostly small )
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( value, &seed );
+				shr_u( value, value, u16( i % 512 ) );
+				u32 k = ( i & 1 ) ? u32( RandomU64( &seed ) % 16 ) + 2 : u32( RandomU64( &seed ) % 520 ) + 2;
+				Assert::AreEqual( s16( 0 ), iroot_u( root, value, k ), _MSGW( L"Return code failed on run #" << i ) );
+				Assert::IsTrue( IsFloorRoot( root, value, k ), _MSGW( L"Failed k " << k << " on run #" << i ) );
+			};
+
+			// 3. exact powers: base^k and base^k - 1
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				u32 k = u32( RandomU64( &seed ) % 30 ) + 2;
+				RandomFill( base, &seed );
+				shr_u( base, base, u16( 512 - 510 / k ) );
+				if ( compare_uT64( base, 2ull ) < 0 )
+				{
+					set_uT64( base, 2ull );
+				};
+				PowReference( value, base, k );
+				iroot_u( root, value, k );
+				Assert::AreEqual( 0, compare_u( root, base ), _MSGW( L"Failed exact power, k " << k << " on run #" << i ) );
+				sub_uT64( value, value, 1ull );
+				iroot_u( root, value, k );
+				sub_uT64( base, base, 1ull );
+				Assert::AreEqual( 0, compare_u( root, base ), _MSGW( L"Failed exact power - 1, k " << k << " on run #" << i ) );
+			};
+
+			string test_message = _MSGA( "Integer k-th root function testing. k zero and one; 2^511 for k 1 to 600; " << test_run_count
+				<< " pseudo-random values and k; " << test_run_count << " exact powers, and one less.\n" );
+			test_message += "Passed. root^k <= value < ( root + 1 )^k; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512roots_03_perfect_power )
+		{
+			u64 seed = 0;
+			_UI512( value ) { 0 };
+			_UI512( root ) { 0 };
+			_UI512( base ) { 0 };
+			_UI512( check ) { 0 };
+			u32 exponent = 0;
+
+			// 1. zero, one, two are not; 2^511 = 2^511; 3^2 * 5^2 = 15^2; 6^5 * 6^3 = 6^8
+			const u64 cases [ 5 ] = { 0, 1, 2, 225, 1679616 };
+			const u64 roots [ 5 ] = { 0, 1, 2, 15, 6 };
+			const u32 exponents [ 5 ] = { 1, 1, 1, 2, 8 };
+			for ( int i = 0; i < 5; i++ )
+			{
+				set_uT64( value, cases [ i ] );
+				s16 rc = is_perfect_power_u( root, &exponent, value );
+				Assert::AreEqual( s16( exponents [ i ] > 1 ? 1 : 0 ), rc, _MSGW( L"Return code failed " << cases [ i ] ) );
+				Assert::AreEqual( 0, compare_uT64( root, roots [ i ] ), _MSGW( L"Root failed " << cases [ i ] ) );
+				Assert::AreEqual( exponents [ i ], exponent, _MSGW( L"Exponent failed " << cases [ i ] ) );
+			};
+			zero_u( value );
+			value [ 0 ] = 0x8000000000000000ull;
+			Assert::AreEqual( s16( 1 ), is_perfect_power_u( root, &exponent, value ), L"Return code failed 2^511" );
+			Assert::AreEqual( 0, compare_uT64( root, 2ull ), L"Root failed 2^511" );
+			Assert::AreEqual( 511u, exponent, L"Exponent failed 2^511" );
+
+			// 2. planted powers: root^exponent is the value, and exponent a multiple of the planted one ( the base may be a power itself )
+			for ( int i = 0; i < test_run_count / 10; i++ )
+			{
+				u32 k = u32( RandomU64( &seed ) % 40 ) + 2;
+				RandomFill( base, &seed );
+				shr_u( base, base, u16( 512 - 510 / k ) );
+				if ( compare_uT64( base, 2ull ) < 0 )
+				{
+					set_uT64( base, 3ull );
+				};
+				PowReference( value, base, k );
+				Assert::AreEqual( s16( 1 ), is_perfect_power_u( root, &exponent, value ), _MSGW( L"Return code failed k " << k << " on run #" << i ) );
+				Assert::AreEqual( 0u, exponent % k, _MSGW( L"Exponent failed k " << k << " on run #" << i ) );
+				PowReference( check, root, exponent );
+				Assert::AreEqual( 0, compare_u( check, value ), _MSGW( L"Root ^ exponent failed on run #" << i ) );
+			};
+
+			// 3. random values ( a perfect power by chance is vanishingly unlikely ), and planted powers plus one
+			for ( int i = 0; i < test_run_count / 10; i++ )
+			{
+				RandomFill( value, &seed );
+				shr_u( value, value, u16( i % 500 ) );
+				value [ 7 ] |= 2ull;												// not zero, one
+				Assert::AreEqual( s16( 0 ), is_perfect_power_u( root, &exponent, value ), _MSGW( L"Return code failed random on run #" << i ) );
+				Assert::AreEqual( 0, compare_u( root, value ), _MSGW( L"Root failed random on run #" << i ) );
+				Assert::AreEqual( 1u, exponent, _MSGW( L"Exponent failed random on run #" << i ) );
+			};
+
+			string test_message = _MSGA( "Perfect power function testing. Small and known values; " << test_run_count / 10
+				<< " planted powers; " << test_run_count / 10 << " pseudo-random values.\n" );
+			test_message += "Passed. Each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512roots_04_performance )
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+			// Sample counts are cut from the usual runs: by 10, and by 100 for perfect powers ( a k-th root for each prime k to 509 )
+
+			const Perf_Tests tests [ 4 ] = { Isqrt, IsqrtBits, Iroot3, PerfectPower };
+			const u32 cuts [ 4 ] = { 10, 10, 10, 100 };
+			const wchar_t* titles [ 4 ] = {
+				L"Integer square root ( Newton ) function performance timing test.\n\n",
+				L"Integer square root ( a bit at a time ) performance timing test, for comparison.\n\n",
+				L"Integer cube root function performance timing test.\n\n",
+				L"Perfect power function performance timing test.\n\n" };
+			for ( int t = 0; t < 4; t++ )
+			{
+				Logger::WriteMessage( titles [ t ] );
+
+				Logger::WriteMessage( L"First run.\n" );
+				perf_stats No1 = Perf_Test_Parms [ 0 ];
+				No1.timing_count /= cuts [ t ];
+				RunStats( &No1, tests [ t ] );
+
+				Logger::WriteMessage( L"Second run.\n" );
+				perf_stats No2 = Perf_Test_Parms [ 1 ];
+				No2.timing_count /= cuts [ t ];
+				RunStats( &No2, tests [ t ] );
+
+				Logger::WriteMessage( L"Third run.\n" );
+				perf_stats No3 = Perf_Test_Parms [ 2 ];
+				No3.timing_count /= cuts [ t ];
+				RunStats( &No3, tests [ t ] );
+			};
+		};
+	};
+};
@@ -0,0 +1,203 @@
+//		ui512_unit_tests_table
+//
+//		File:			ui512_unit_tests_table.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2026, per MIT License below
+//		Date:			October 17, 2026 (file creation)
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_table.h"
+#include "ui512_unit_tests.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_table )
+	{
+		TEST_METHOD( ui512table_01_create_open )
+		{
+			const char* path = "ui512_table_test.bin";
+			const u64 count = 1000;
+			const u32 width = 2;
+			const u64 tag = 0x5245534944554553ull;
+			ui512_table table;
+			ui512_table reader;
+			ui512_table second;
+			_UI512( expected ) { 0 };
+
+			// 1. layout; refused arguments
+			Assert::AreEqual( size_t( 64 ), sizeof( ui512_table_header ), L"Header size failed" );
+			Assert::AreEqual( s16( -1 ), table_create( &table, path, count, 0, tag ), L"Return code failed zero width" );
+			Assert::AreEqual( s16( -1 ), table_create( &table, path, ~0ull, width, tag ), L"Return code failed size overflow" );
+			std::remove( path );
+			Assert::AreEqual( s16( -1 ), table_open( &table, path ), L"Return code failed missing file" );
+
+			// 2. create, fill in place: pseudo-random first values; each second value the sum of its first and the previous record's ( add_u on the mapping )
+			u64 seed = 0;
+			Assert::AreEqual( s16( 0 ), table_create( &table, path, count, width, tag ), L"Return code failed create" );
+			Assert::AreEqual( count, table.count, L"Count failed create" );
+			for ( u64 i = 0; i < count; i++ )
+			{
+				u64* rec = table_record( &table, i );
+				Assert::AreEqual( 0, compare_uT64( rec, 0ull ), L"Created table not zero filled" );
+				Assert::AreEqual( u64( 0 ), u64( rec ) % 64, L"Record not 64 byte aligned" );
+				RandomFill( rec, &seed );
+				add_u( rec + 8, rec, ( i == 0 ) ? rec : table_record( &table, i - 1 ) );
+			};
+			Assert::AreEqual( s16( 0 ), table_advise( &table, table_advice_sequential | table_advice_hugepage ), L"Return code failed advise" );
+			Assert::AreEqual( s16( 0 ), table_sync( &table ), L"Return code failed sync" );
+			table_close( &table );
+
+			// 3. reopen read only, twice ( shared ); advise random; every value checked against the same pseudo-random sequence
+			Assert::AreEqual( s16( 0 ), table_open( &reader, path ), L"Return code failed open" );
+			Assert::AreEqual( s16( 0 ), table_open( &second, path ), L"Return code failed second open" );
+			Assert::AreEqual( s16( 0 ), table_advise( &reader, table_advice_random ), L"Return code failed advise random" );
+			Assert::AreEqual( count, reader.count, L"Count failed open" );
+			Assert::AreEqual( width, reader.width, L"Width failed open" );
+			Assert::AreEqual( tag, reader.tag, L"Tag failed open" );
+			Assert::IsFalse( reader.writable, L"Read only open writable" );
+			seed = 0;
+			_UI512( previous ) { 0 };
+			for ( u64 i = 0; i < count; i++ )
+			{
+				const u64* rec = table_record( &reader, i );
+				RandomFill( expected, &seed );
+				Assert::AreEqual( 0, compare_u( rec, expected ), _MSGW( L"Value failed at record " << i ) );
+				add_u( expected, rec, ( i == 0 ) ? rec : previous );
+				Assert::AreEqual( 0, compare_u( rec + 8, expected ), _MSGW( L"Sum value failed at record " << i ) );
+				Assert::AreEqual( 0, compare_u( table_record( &second, i ), rec ), _MSGW( L"Second mapping differs at record " << i ) );
+				copy_u( previous, rec );
+			};
+
+			// 4. a writable mapping's change shows through the read only one ( the same pages )
+			Assert::AreEqual( s16( 0 ), table_open( &table, path, true ), L"Return code failed writable open" );
+			set_uT64( table_record( &table, 7 ), 12345ull );
+			Assert::AreEqual( 0, compare_uT64( table_record( &reader, 7 ), 12345ull ), L"Change not seen through the shared mapping" );
+			table_close( &table );
+			table_close( &second );
+			table_close( &reader );
+
+			// 5. damaged files refused: wrong size, wrong magic, wrong version; each damage undone before the next, so each check is the one refusing
+			const std::uintmax_t file_bytes = std::filesystem::file_size( path );
+			{
+				std::ofstream grow( path, std::ios::binary | std::ios::app );
+				grow.put( 0 );
+			};
+			Assert::AreEqual( s16( -1 ), table_open( &reader, path ), L"Return code failed wrong size" );
+			std::filesystem::resize_file( path, file_bytes );
+			Assert::AreEqual( s16( 0 ), table_open( &reader, path ), L"Return code failed size restored" );
+			table_close( &reader );
+			{
+				std::fstream damage( path, std::ios::in | std::ios::out | std::ios::binary );
+				damage.put( 'X' );
+			};
+			Assert::AreEqual( s16( -1 ), table_open( &reader, path ), L"Return code failed wrong magic" );
+			{
+				std::fstream damage( path, std::ios::in | std::ios::out | std::ios::binary );
+				damage.write( ( const char* ) &ui512_table_magic, sizeof( ui512_table_magic ) );
+				const u32 version = ui512_table_version + 1;
+				damage.write( ( const char* ) &version, sizeof( version ) );
+			};
+			Assert::AreEqual( s16( -1 ), table_open( &reader, path ), L"Return code failed wrong version" );
+			std::remove( path );
+
+			string test_message = _MSGA( "Mapped table testing. Layout; refused arguments; " << count << " records of " << width
+				<< " values created, filled in place by the kernels, reopened read only twice, shared with a writable mapping; damaged files ( size, magic, version ).\n" );
+			test_message += "Passed. Values verified against regenerated pseudo-random values and sums; each via assert.\n\n";
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+
+		TEST_METHOD( ui512table_02_load_performance )
+		{
+			// Performance timing, loading a table and summing it. Not pass/fail, informational only.
+			// Read: the file read ( ifstream ) into an alignas( 64 ) buffer, then summed. Mapped: opened, hinted sequential, summed in place.
+			// Both from a warm page cache ( the file was just written ); the difference is the copy, and the buffer it needs.
+			// Wall clock ( steady_clock ), best of three.
+
+			const char* path = "ui512_table_perf.bin";
+			const u64 count = 1 << 18;
+			ui512_table table;
+			u64 seed = 0;
+			table_create( &table, path, count, 1, 0 );
+			for ( u64 i = 0; i < count; i++ )
+			{
+				RandomFill( table_record( &table, i ), &seed );
+				shr_u( table_record( &table, i ), table_record( &table, i ), 20 );
+			};
+			table_close( &table );
+
+			_UI512( sum ) { 0 };
+			double best [ 2 ] = { 0, 0 };
+			for ( int run = 0; run < 3; run++ )
+			{
+				auto start = std::chrono::steady_clock::now( );
+				{
+					std::vector<ui512_table_header> buffer( size_t( count + 1 ) );		// 64 byte aligned, 64 byte elements
+					std::ifstream in( path, std::ios::binary );
+					in.read( ( char* ) buffer.data( ), std::streamsize( ( count + 1 ) * 64 ) );
+					const u64* values = ( const u64* ) ( buffer.data( ) + 1 );
+					zero_u( sum );
+					for ( u64 i = 0; i < count; i++ )
+					{
+						add_u( sum, sum, values + i * 8 );
+					};
+				};
+				double read_us = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+
+				start = std::chrono::steady_clock::now( );
+				table_open( &table, path );
+				table_advise( &table, table_advice_sequential );
+				zero_u( sum );
+				for ( u64 i = 0; i < count; i++ )
+				{
+					add_u( sum, sum, table_record( &table, i ) );
+				};
+				table_close( &table );
+				double mapped_us = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+
+				best [ 0 ] = ( run == 0 || read_us < best [ 0 ] ) ? read_us : best [ 0 ];
+				best [ 1 ] = ( run == 0 || mapped_us < best [ 1 ] ) ? mapped_us : best [ 1 ];
+			};
+			std::remove( path );
+
+			string test_message = _MSGA( "Table load and sum, " << count << " values ( " << count * 64 / 1024 << "K bytes ).\n" );
+			test_message += _MSGA( "read into buffer:\t" << best [ 0 ] << " us\nmapped, in place:\t" << best [ 1 ] << " us\t( "
+				<< best [ 0 ] / best [ 1 ] << " times faster )\n\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+		};
+	};
+};